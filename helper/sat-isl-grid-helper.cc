@@ -0,0 +1,297 @@
+/**
+ * @brief   +Grid Interconnect Generation for Walker Constellations
+ *
+ * @file    sat-isl-grid-helper.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-isl-grid-helper.h"
+#include "sat-node-tag.h"
+#include "ns3/sat-isl-ipv4-routing.h"
+
+#include "ns3/log.h"
+#include "ns3/ipv4.h"
+#include "ns3/enum.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatISLGridHelper");
+    NS_OBJECT_ENSURE_REGISTERED(SatISLGridHelper);
+
+
+    TypeId SatISLGridHelper::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatISLGridHelper")
+            .SetParent<Object>()
+            .AddConstructor<SatISLGridHelper>()
+            .AddAttribute("PolarLatitude",
+                        "Latitude in Degree above which the Cross-Plane Links are shut down, 90 disables the Shutdown",
+                        DoubleValue(90.0),
+                        MakeDoubleAccessor(&SatISLGridHelper::m_polarLatitude),
+                        MakeDoubleChecker<double>(0.0, 90.0)
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatISLGridHelper::SatISLGridHelper()
+    : m_polarLatitude(90.0)
+    {
+    }
+
+
+    SatISLGridHelper::~SatISLGridHelper()
+    {
+    }
+
+
+    void SatISLGridHelper::DoDispose()
+    {
+        for (auto &member : m_members)
+        {
+            Simulator::Cancel(member.event);
+        }
+
+        m_members.clear();
+        m_icm = nullptr;
+        Object::DoDispose();
+    }
+
+
+    size_t SatISLGridHelper::Install(Ptr<WalkerConstellationHelper> constellation, Ptr<SatISLInterconTable> icm)
+    {
+        NS_LOG_FUNCTION(this << constellation);
+
+        m_icm = (icm != nullptr) ? icm : SatISLInterconTable::Get();
+
+        const int planes = constellation->getOrbitCount();
+        if (planes == 0) return 0;
+
+        const int sats = constellation->getOrbit(0)->getSatelliteCount();
+        const bool seam = (constellation->getType() == WalkerConstellationHelper::WALKER_DELTA);
+        const double sinInc = sin(constellation->getInclination() * M_PI / 180.0);
+        const double motion = WalkerConstellationHelper::twoPi * constellation->getMeanMotion() / WalkerConstellationHelper::secsPerDay;
+
+        // Members are indexed by Plane and Slot
+        const size_t base = m_members.size();
+        m_members.reserve(base + planes * sats);
+
+        for (int p = 0; p < planes; p++)
+        {
+            NodeContainer nodes = constellation->getOrbit(p)->getSatellites();
+            for (int s = 0; s < sats; s++)
+            {
+                Member member;
+                member.id = nodes.Get(s)->GetObject<SatelliteNodeTag>()->GetId();
+                member.mobility = nodes.Get(s)->GetObject<MobilityModel>();
+                member.sinInc = sinInc;
+                member.motion = motion;
+                member.polar = false;
+                member.bound = -1;
+                member.cross[0] = member.cross[1] = 0;
+                member.peer[0] = member.peer[1] = 0;
+
+                m_members.push_back(member);
+            }
+        }
+
+        size_t links = 0;
+
+        // Fore and Aft within the Plane
+        for (int p = 0; p < planes && sats > 1; p++)
+        {
+            for (int s = 0; s < sats; s++)
+            {
+                _link(m_members[base + p * sats + s].id, m_members[base + p * sats + (s + 1) % sats].id);
+                links += 2;
+            }
+        }
+
+        // Left and Right to the nearest Slot of the next Plane, Phases as set by the WalkerConstellationHelper
+        for (int p = 0; p < planes; p++)
+        {
+            int q = p + 1;
+            if (q == planes)
+            {
+                if (!seam || planes < 3) break;
+                q = 0;
+            }
+
+            double phaseFrom = fmod(360.0 - fmod(p * constellation->getPhasing(), 360.0), 360.0);
+            double phaseTo = fmod(360.0 - fmod(q * constellation->getPhasing(), 360.0), 360.0);
+            int offset = _slotOffset(phaseFrom, phaseTo, sats);
+
+            for (int s = 0; s < sats; s++)
+            {
+                size_t a = base + p * sats + s;
+                size_t b = base + q * sats + (s + offset) % sats;
+
+                m_members[a].cross[1] = m_members[b].id;
+                m_members[a].peer[1] = b;
+                m_members[b].cross[0] = m_members[a].id;
+                m_members[b].peer[0] = a;
+            }
+        }
+
+        // Initial Polar State, then one Event per Threshold Crossing
+        const double threshold = sin(m_polarLatitude * M_PI / 180.0);
+        const bool shutdown = (m_polarLatitude < 90.0) && (threshold < sinInc);
+
+        for (size_t n = base; n < m_members.size() && shutdown; n++)
+        {
+            m_members[n].polar = fabs(sin(_argumentOfLatitude(m_members[n]))) * sinInc > threshold;
+            _schedule(n);
+        }
+
+        for (size_t n = base; n < m_members.size(); n++)
+        {
+            if (m_members[n].cross[1] == 0) continue;
+
+            _update(n, 1);
+            if (!m_members[n].polar && !m_members[m_members[n].peer[1]].polar) links += 2;
+        }
+
+        NS_LOG_INFO("+Grid of " << planes << " x " << sats << " Satellites with " << links << " Links");
+
+        return links;
+    }
+
+
+    size_t SatISLGridHelper::ConfigureRouting(Ptr<WalkerConstellationHelper> constellation, const Ipv4Address base)
+    {
+        NS_LOG_FUNCTION(this << constellation << base);
+
+        const bool seam = (constellation->getType() == WalkerConstellationHelper::WALKER_DELTA);
+        size_t count = 0;
+
+        for (int p = 0; p < constellation->getOrbitCount(); p++)
+        {
+            NodeContainer nodes = constellation->getOrbit(p)->getSatellites();
+            for (auto it = nodes.Begin(); it != nodes.End(); it++)
+            {
+                Ptr<Ipv4> ipv4 = (*it)->GetObject<Ipv4>();
+                Ptr<SatelliteISLRoutingIPv4> routing = (ipv4 != nullptr) ? DynamicCast<SatelliteISLRoutingIPv4>(ipv4->GetRoutingProtocol()) : nullptr;
+                if (routing == nullptr) continue;
+
+                routing->SetAttribute("Mode", EnumValue(SatelliteISLRoutingIPv4::ROUTING_GRID));
+                routing->SetGrid(constellation->getPhasing(), seam, base, m_icm);
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+
+    int SatISLGridHelper::_slotOffset(const double phaseFrom, const double phaseTo, const int satsPerOrbit)
+    {
+        double delta = 360.0 / satsPerOrbit;
+        double shift = fmod(phaseFrom - phaseTo + 720.0, 360.0);
+
+        return ((int) lround(shift / delta)) % satsPerOrbit;
+    }
+
+
+    double SatISLGridHelper::_argumentOfLatitude(const Member &member)
+    {
+        // z = r sin(i) sin(u) and dz/dt = r n sin(i) cos(u), both unaffected by the Earth Rotation
+        Vector pos = member.mobility->GetPosition();
+        Vector vel = member.mobility->GetVelocity();
+
+        double r = sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z);
+        if (r <= 0.0 || member.sinInc <= 0.0) return 0.0;
+
+        return atan2(pos.z, vel.z / member.motion);
+    }
+
+
+    void SatISLGridHelper::_link(const satid_t a, const satid_t b)
+    {
+        m_icm->Add(a, b);
+        m_icm->Add(b, a);
+    }
+
+
+    void SatISLGridHelper::_schedule(const size_t index)
+    {
+        Member &member = m_members[index];
+
+        // Crossings of |sin(u)| = sin(lat) / sin(i), four per Revolution
+        double ustar = asin(sin(m_polarLatitude * M_PI / 180.0) / member.sinInc);
+        double bounds[4] = { ustar, M_PI - ustar, M_PI + ustar, 2.0 * M_PI - ustar };
+
+        double u = _argumentOfLatitude(member);
+
+        // The first Crossing is the nearest one, then they follow in Order
+        if (member.bound < 0)
+        {
+            double best = 4.0 * M_PI;
+            for (int n = 0; n < 4; n++)
+            {
+                double d = fmod(bounds[n] - u + 4.0 * M_PI, 2.0 * M_PI);
+                if (d < best)
+                {
+                    best = d;
+                    member.bound = n;
+                }
+            }
+        }
+
+        double du = fmod(bounds[member.bound] - u + 4.0 * M_PI, 2.0 * M_PI);
+
+        // Already slightly past the Crossing, the Propagator may drift from the mean Motion
+        if (du > 1.5 * M_PI) du = 0.0;
+
+        member.event = Simulator::Schedule(Seconds(du / member.motion), &SatISLGridHelper::_cross, this, index);
+    }
+
+
+    void SatISLGridHelper::_cross(const size_t index)
+    {
+        Member &member = m_members[index];
+
+        // Crossings 0 and 2 enter the Polar Region, 1 and 3 leave it
+        member.polar = (member.bound % 2 == 0);
+        member.bound = (member.bound + 1) % 4;
+
+        NS_LOG_FUNCTION(this << member.id << member.polar);
+
+        _update(index, 0);
+        _update(index, 1);
+        _schedule(index);
+    }
+
+
+    void SatISLGridHelper::_update(const size_t index, const int side)
+    {
+        const Member &member = m_members[index];
+        if (member.cross[side] == 0) return;
+
+        if (!member.polar && !m_members[member.peer[side]].polar)
+        {
+            _link(member.id, member.cross[side]);
+        }
+        else
+        {
+            m_icm->Remove(member.id, member.cross[side]);
+            m_icm->Remove(member.cross[side], member.id);
+        }
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,128 @@
+/**
+ * @brief   +Grid Interconnect Generation for Walker Constellations
+ *
+ * @file    sat-isl-grid-helper.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ISL_GRID_HELPER_H
+#define SATELLITE_ISL_GRID_HELPER_H
+
+
+#include "ns3/object.h"
+#include "ns3/mobility-model.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv4-address.h"
+
+#include "ns3/sat-isl-def.h"
+#include "ns3/sat-isl-intercon-table.h"
+#include "walker-constellation-helper.h"
+
+#include <vector>
+
+
+namespace ns3
+{
+
+    /**
+     * @brief Fill the Interconnect Matrix (ICM) with the +Grid of a Walker Constellation
+     *
+     *        Each Satellite gets four Links: fore and aft in its Plane and left and right to
+     *        the nearest Slot of the neighbouring Planes. The Seam of a Walker-Star (and Polar)
+     *        Constellation is counter-rotating and gets no Cross-Plane Links, the Seam of a
+     *        Walker-Delta is closed.
+     *
+     *        Above the PolarLatitude the Cross-Plane Links are shut down. The Crossings of
+     *        the Threshold follow in closed Form from the Argument of Latitude, so one Event
+     *        per Satellite and Crossing is scheduled instead of polling the Positions.
+     */
+    class SatISLGridHelper : public Object
+    {
+    public:
+
+        static TypeId GetTypeId();
+
+        SatISLGridHelper();
+        ~SatISLGridHelper();
+
+
+        /**
+         * @brief Add the +Grid of an initialized Constellation
+         *
+         * @param constellation     Walker Constellation
+         * @param icm               Target ICM, the global one by Default
+         * @return size_t           Number of added (directed) Links
+         */
+        size_t Install(Ptr<WalkerConstellationHelper> constellation, Ptr<SatISLInterconTable> icm = nullptr);
+
+        /**
+         * @brief Switch the SatelliteISLRoutingIPv4 of a Constellation to the +Grid Mode
+         *
+         * @param constellation     Walker Constellation with installed Internet Stacks
+         * @param base              Address of Satellite ID zero, the ISL Addresses must be base + ID
+         * @return size_t           Number of configured Satellites
+         */
+        size_t ConfigureRouting(Ptr<WalkerConstellationHelper> constellation, const Ipv4Address base);
+
+
+    protected:
+
+        void DoDispose() override;
+
+
+    private:
+
+        /**
+         * @brief Satellite with Cross-Plane Links
+         */
+        struct Member
+        {
+            satid_t id;                     //!< Satellite ID
+            Ptr<MobilityModel> mobility;    //!< Position Source for the Argument of Latitude
+            double sinInc;                  //!< Sine of the Inclination
+            double motion;                  //!< Mean Motion in rad/s
+            bool polar;                     //!< Above the PolarLatitude
+            int bound;                      //!< Index of the next Crossing, negative before the first
+            satid_t cross[2];               //!< Left and right Neighbour, zero if none
+            size_t peer[2];                 //!< Member Index of the Neighbours
+            EventId event;                  //!< Next Threshold Crossing
+        };
+
+
+        /**
+         * @brief Slot Offset to the nearest Satellite of another Plane
+         */
+        static int _slotOffset(const double phaseFrom, const double phaseTo, const int satsPerOrbit);
+
+        /**
+         * @brief Argument of Latitude from the Out-of-Plane Components (independent of the Earth Rotation)
+         */
+        static double _argumentOfLatitude(const Member &member);
+
+        void _link(const satid_t a, const satid_t b);
+
+        void _schedule(const size_t index);
+
+        void _cross(const size_t index);
+
+        void _update(const size_t index, const int side);
+
+
+        double m_polarLatitude;                     //!< Cross-Plane Links are shut down above, in Degree
+
+        Ptr<SatISLInterconTable> m_icm;             //!< Target ICM
+        std::vector<Member> m_members;              //!< Satellites with Cross-Plane Links
+
+    };  /* SatISLGridHelper */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_GRID_HELPER_H */
@@ -0,0 +1,220 @@
+/**
+ * @brief   Dense Registry of Satellite Nodes
+ *
+ * @file    sat-node-registry.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-node-registry.h"
+#include "sat-node-tag.h"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/simulator.h"
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatelliteRegistry");
+    NS_OBJECT_ENSURE_REGISTERED(SatelliteRegistry);
+
+
+    Ptr<SatelliteRegistry> SatelliteRegistry::m_default = nullptr;
+
+    const orbid_t SatelliteRegistry::MAX_ORBIT_ID = (1u << 20);
+
+    static const std::vector<satid_t> NO_SATS;
+    static const std::vector<orbid_t> NO_ORBITS;
+
+
+    TypeId SatelliteRegistry::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatelliteRegistry")
+            .SetParent<Object>()
+            .AddConstructor<SatelliteRegistry>()
+        ;
+
+        return tid;
+    }
+
+
+    Ptr<SatelliteRegistry> SatelliteRegistry::Get()
+    {
+        if (m_default == nullptr)
+        {
+            m_default = CreateObject<SatelliteRegistry>();
+            Simulator::ScheduleDestroy(&SatelliteRegistry::Reset);
+        }
+
+        return m_default;
+    }
+
+
+    void SatelliteRegistry::Reset()
+    {
+        NS_LOG_FUNCTION_NOARGS();
+
+        if (m_default != nullptr)
+        {
+            m_default->Dispose();
+            m_default = nullptr;
+        }
+    }
+
+
+    SatelliteRegistry::SatelliteRegistry()
+    : m_orbitsN(0)
+    , m_cstN(0)
+    {
+    }
+
+
+    SatelliteRegistry::~SatelliteRegistry()
+    {
+    }
+
+
+    void SatelliteRegistry::DoDispose()
+    {
+        Clear();
+        Object::DoDispose();
+    }
+
+
+    satid_t SatelliteRegistry::Register(Ptr<SatelliteNodeTag> tag, const cstid_t constellationID, const orbid_t orbitID)
+    {
+        NS_LOG_FUNCTION(this << tag << (int) constellationID << orbitID);
+        NS_ASSERT_MSG(m_tags.size() < UINT32_MAX, "Satellite IDs exhausted");
+        NS_ABORT_MSG_IF(orbitID > MAX_ORBIT_ID, "Orbit ID " << orbitID << " exceeds " << MAX_ORBIT_ID << ", Orbit IDs are expected to be consecutive");
+
+        m_tags.push_back(tag);
+        satid_t id = m_tags.size();
+
+        if (orbitID >= m_orbitSats.size())
+        {
+            m_orbitSats.resize(orbitID + 1);
+        }
+
+        std::vector<satid_t> &sats = m_orbitSats[orbitID];
+
+        // A new Orbit belongs to the Constellation of its first Satellite
+        if (sats.empty())
+        {
+            if (constellationID >= m_cstOrbits.size())
+            {
+                m_cstOrbits.resize(constellationID + 1);
+            }
+
+            if (m_cstOrbits[constellationID].empty()) m_cstN++;
+            m_cstOrbits[constellationID].push_back(orbitID);
+            m_orbitsN++;
+        }
+
+        sats.push_back(id);
+        return id;
+    }
+
+
+    void SatelliteRegistry::Clear()
+    {
+        NS_LOG_FUNCTION(this << m_tags.size());
+
+        m_tags.clear();
+        m_orbitSats.clear();
+        m_cstOrbits.clear();
+        m_orbitsN = 0;
+        m_cstN = 0;
+    }
+
+
+    size_t SatelliteRegistry::GetSatsN() const
+    {
+        return m_tags.size();
+    }
+
+
+    size_t SatelliteRegistry::GetOrbitsN() const
+    {
+        return m_orbitsN;
+    }
+
+
+    size_t SatelliteRegistry::GetConstellationsN() const
+    {
+        return m_cstN;
+    }
+
+
+    size_t SatelliteRegistry::GetSatsN(const orbid_t orbitID) const
+    {
+        return SatsByOrbit(orbitID).size();
+    }
+
+
+    size_t SatelliteRegistry::GetOrbitsN(const cstid_t constellationID) const
+    {
+        return OrbitsByConstellation(constellationID).size();
+    }
+
+
+    const std::vector<satid_t>& SatelliteRegistry::SatsByOrbit(const orbid_t orbitID) const
+    {
+        if (orbitID < m_orbitSats.size())
+            return m_orbitSats[orbitID];
+
+        return NO_SATS;
+    }
+
+
+    const std::vector<orbid_t>& SatelliteRegistry::OrbitsByConstellation(const cstid_t constellationID) const
+    {
+        if (constellationID < m_cstOrbits.size())
+            return m_cstOrbits[constellationID];
+
+        return NO_ORBITS;
+    }
+
+
+    orbid_t SatelliteRegistry::GetMaxOrbitId() const
+    {
+        for (size_t n = m_orbitSats.size(); n > 0; n--)
+        {
+            if (!m_orbitSats[n - 1].empty()) return n - 1;
+        }
+
+        return 0;
+    }
+
+
+    bool SatelliteRegistry::GetExists(const satid_t id) const
+    {
+        return id > 0 && id <= m_tags.size();
+    }
+
+
+    Ptr<SatelliteNodeTag> SatelliteRegistry::GetTag(const satid_t id) const
+    {
+        if (!GetExists(id))
+            return nullptr;
+
+        return m_tags[id - 1];
+    }
+
+
+    Ptr<Node> SatelliteRegistry::GetSatellite(const satid_t id) const
+    {
+        if (!GetExists(id))
+            return nullptr;
+
+        return m_tags[id - 1]->GetObject<Node>();
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,138 @@
+/**
+ * @brief   Dense Registry of Satellite Nodes
+ *
+ * @file    sat-node-registry.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_NODE_REGISTRY_H
+#define SATELLITE_NODE_REGISTRY_H
+
+
+#include "ns3/object.h"
+#include "ns3/node.h"
+
+#include "ns3/sat-isl-def.h"
+
+#include <vector>
+
+
+namespace ns3
+{
+
+    class SatelliteNodeTag;
+
+
+    /**
+     * @brief Registry of the Satellites of one Simulation
+     *
+     *        Satellite IDs are handed out densely from 1, so the Lookup by ID is an Array Access.
+     *        The Satellites of an Orbit and the Orbits of a Constellation are kept in contiguous
+     *        Arrays, indexed by the Orbit and Constellation ID.
+     *
+     *        The default Registry (Get) belongs to the current Simulation and is dropped on
+     *        Simulator::Destroy, so Parameter Sweeps in one Process start from a clean State.
+     */
+    class SatelliteRegistry : public Object
+    {
+    public:
+
+        static TypeId GetTypeId();
+
+        /**
+         * @brief Get the Registry of the current Simulation, created on Demand
+         *
+         * @return Ptr<SatelliteRegistry>
+         */
+        static Ptr<SatelliteRegistry> Get();
+
+        /**
+         * @brief Drop the Registry of the current Simulation, the next Get creates a new one
+         */
+        static void Reset();
+
+
+        SatelliteRegistry();
+        ~SatelliteRegistry();
+
+
+        static const orbid_t MAX_ORBIT_ID;      //!< Largest Orbit ID, the Orbits are an Array indexed by the ID
+
+
+        /**
+         * @brief Register a Satellite
+         *
+         * @param tag               Tag of the Satellite (aggregated to its Node)
+         * @param constellationID   Constellation of the Orbit
+         * @param orbitID           Orbit of the Satellite, at most MAX_ORBIT_ID
+         * @return satid_t          Assigned Satellite ID
+         */
+        satid_t Register(Ptr<SatelliteNodeTag> tag, const cstid_t constellationID, const orbid_t orbitID);
+
+        /**
+         * @brief Remove all Satellites, Orbits and Constellations
+         */
+        void Clear();
+
+
+        size_t GetSatsN() const;
+        size_t GetOrbitsN() const;
+        size_t GetConstellationsN() const;
+
+        size_t GetSatsN(const orbid_t orbitID) const;
+        size_t GetOrbitsN(const cstid_t constellationID) const;
+
+        /**
+         * @brief Get the Satellites of an Orbit, in the Order of their Registration
+         */
+        const std::vector<satid_t>& SatsByOrbit(const orbid_t orbitID) const;
+
+        /**
+         * @brief Get the Orbits of a Constellation, in the Order of their Registration
+         */
+        const std::vector<orbid_t>& OrbitsByConstellation(const cstid_t constellationID) const;
+
+        /**
+         * @brief Get the largest used Orbit ID, the next free one is one above
+         *
+         * @return orbid_t  zero if no Orbit is registered
+         */
+        orbid_t GetMaxOrbitId() const;
+
+
+        bool GetExists(const satid_t id) const;
+
+        Ptr<SatelliteNodeTag> GetTag(const satid_t id) const;
+
+        Ptr<Node> GetSatellite(const satid_t id) const;
+
+
+    protected:
+
+        void DoDispose() override;
+
+
+    private:
+
+        std::vector<Ptr<SatelliteNodeTag>> m_tags;              //!< Tag by Satellite ID - 1
+        std::vector<std::vector<satid_t>> m_orbitSats;          //!< Satellites by Orbit ID
+        std::vector<std::vector<orbid_t>> m_cstOrbits;          //!< Orbits by Constellation ID
+
+        size_t m_orbitsN;                                       //!< Number of non-empty Orbits
+        size_t m_cstN;                                          //!< Number of non-empty Constellations
+
+        static Ptr<SatelliteRegistry> m_default;                //!< Registry of the current Simulation
+
+    };  /* SatelliteRegistry */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_NODE_REGISTRY_H */
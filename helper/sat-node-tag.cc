@@ -16,10 +16,6 @@
 
 namespace ns3
 {
-    std::unordered_map<uint8_t, std::vector<uint16_t>> SatelliteNodeTag::m_CmapO;
-    std::unordered_map<uint16_t, std::vector<uint16_t>> SatelliteNodeTag::m_OmapS;
-    std::unordered_map<uint16_t, Ptr<SatelliteNodeTag>> SatelliteNodeTag::m_globalNodes;
-
 
     TypeId SatelliteNodeTag::GetTypeId()
     {
@@ -30,13 +26,13 @@ namespace ns3
                       "Constellation ID ( 1 - 255 )",
                       IntegerValue(1),
                       MakeIntegerAccessor(&SatelliteNodeTag::m_CID),
-                      MakeIntegerChecker<uint8_t>(1, 255)
+                      MakeIntegerChecker<cstid_t>(1, 255)
             )
             .AddAttribute("OrbitID",
-                        "Orbit ID ( 1 - 2^16 )",
+                        "Orbit ID ( 1 - 2^32 )",
                         IntegerValue(1),
                         MakeIntegerAccessor(&SatelliteNodeTag::m_OID),
-                        MakeIntegerChecker<uint16_t>(1)
+                        MakeIntegerChecker<orbid_t>(1)
             )
         ;
 
@@ -44,88 +40,64 @@ namespace ns3
     }
 
 
-    uint16_t SatelliteNodeTag::GetConstellationsN()
+    size_t SatelliteNodeTag::GetConstellationsN()
     {
-        return (uint16_t) m_CmapO.size();
+        return SatelliteRegistry::Get()->GetConstellationsN();
     }
 
 
-    uint16_t SatelliteNodeTag::GetOrbitsN()
+    size_t SatelliteNodeTag::GetOrbitsN()
     {
-        return (uint16_t) m_OmapS.size();
+        return SatelliteRegistry::Get()->GetOrbitsN();
     }
 
 
-    uint16_t SatelliteNodeTag::GetOrbitsN(const uint8_t constellationID)
+    size_t SatelliteNodeTag::GetOrbitsN(const cstid_t constellationID)
     {
-        if (auto search = m_CmapO.find(constellationID); search != m_CmapO.end())
-        {
-            return search->second.size();
-        }
-
-        return 0;
+        return SatelliteRegistry::Get()->GetOrbitsN(constellationID);
     }
 
 
-    uint16_t SatelliteNodeTag::GetSatsN()
+    size_t SatelliteNodeTag::GetSatsN()
     {
-        return m_globalNodes.size();
+        return SatelliteRegistry::Get()->GetSatsN();
     }
 
 
-    uint16_t SatelliteNodeTag::GetSatsN(const uint16_t orbitID)
+    size_t SatelliteNodeTag::GetSatsN(const orbid_t orbitID)
     {
-        if (auto search = m_OmapS.find(orbitID); search != m_OmapS.end())
-        {
-            return search->second.size();
-        }
-
-        return 0;
+        return SatelliteRegistry::Get()->GetSatsN(orbitID);
     }
 
 
-    std::vector<satid_t> SatelliteNodeTag::SatsByOrbit(const orbid_t orbitID)
+    const std::vector<satid_t>& SatelliteNodeTag::SatsByOrbit(const orbid_t orbitID)
     {
-        if (auto sat_vec = m_OmapS.find(orbitID); sat_vec != m_OmapS.end())
-        {
-            return sat_vec->second;
-        }
-
-        return std::vector<uint16_t>();
+        return SatelliteRegistry::Get()->SatsByOrbit(orbitID);
     }
 
 
-    std::vector<uint16_t> SatelliteNodeTag::OrbitsByConstellation(const uint8_t constellationID)
+    const std::vector<orbid_t>& SatelliteNodeTag::OrbitsByConstellation(const cstid_t constellationID)
     {
-        if (auto orb_vec = m_CmapO.find(constellationID); orb_vec != m_CmapO.end())
-        {
-            return orb_vec->second;
-        }
-
-        return std::vector<uint16_t>();
+        return SatelliteRegistry::Get()->OrbitsByConstellation(constellationID);
     }
 
 
-    Ptr<Node> SatelliteNodeTag::GetSatellite(const uint16_t id)
+    Ptr<Node> SatelliteNodeTag::GetSatellite(const satid_t id)
     {
-        if (auto sat = m_globalNodes.find(id); sat != m_globalNodes.end())
-        {
-            return sat->second->GetObject<Node>();
-        }
-
-        return nullptr;
+        return SatelliteRegistry::Get()->GetSatellite(id);
     }
 
 
     bool SatelliteNodeTag::GetExists(const satid_t id)
     {
-        if (m_globalNodes.find(id) != m_globalNodes.end()) return true;
-        
-        return false;
+        return SatelliteRegistry::Get()->GetExists(id);
     }
 
 
     SatelliteNodeTag::SatelliteNodeTag()
+    : m_CID(1)
+    , m_OID(1)
+    , m_id(0)
     {
     }
 
@@ -135,19 +107,19 @@ namespace ns3
     }
 
 
-    uint16_t SatelliteNodeTag::GetId() const
+    satid_t SatelliteNodeTag::GetId() const
     {
         return m_id;
     }
 
 
-    uint8_t SatelliteNodeTag::GetCID() const
+    cstid_t SatelliteNodeTag::GetCID() const
     {
         return m_CID;
     }
 
 
-    uint16_t SatelliteNodeTag::GetOID() const
+    orbid_t SatelliteNodeTag::GetOID() const
     {
         return m_OID;
     }
@@ -155,43 +127,11 @@ namespace ns3
 
     void SatelliteNodeTag::Register()
     {
-        m_id = m_globalNodes.size() + 1;
-
-        while (m_globalNodes.find(m_id) != m_globalNodes.end())
-        {
-            m_id++;
-        }
-        m_globalNodes.insert(std::pair{m_id, Ptr<SatelliteNodeTag>(this)});
-
-        // Register Satellite to Orbit
-        auto orb_vec = m_OmapS.find(m_OID);
-        if (orb_vec != m_OmapS.end())
-        {
-            // Is Known Orbit
-            orb_vec->second.push_back(m_id);
-        }
-        else 
-        {
-            // Register New Orbit
-            m_OmapS.insert(std::pair{m_OID, std::vector<uint16_t>({m_id})});
-
-            // Register Orbit to Constellation
-            auto cst_vec = m_CmapO.find(m_CID);
-
-            if (cst_vec != m_CmapO.end())
-            {
-                // Is Known Constellation
-                cst_vec->second.push_back(m_OID);
-            }
-            else
-            {
-                m_CmapO.insert(std::pair{m_CID, std::vector<uint16_t>({m_OID})});
-            }
-        }
+        Register(SatelliteRegistry::Get());
     }
 
 
-    void SatelliteNodeTag::Register(const uint8_t constellationID, const uint16_t orbitID)
+    void SatelliteNodeTag::Register(const cstid_t constellationID, const orbid_t orbitID)
     {
         m_CID = constellationID;
         m_OID = orbitID;
@@ -199,4 +139,10 @@ namespace ns3
     }
 
 
-}   /* namespace ns3 */
\ No newline at end of file
+    void SatelliteNodeTag::Register(Ptr<SatelliteRegistry> registry)
+    {
+        m_id = registry->Register(this, m_CID, m_OID);
+    }
+
+
+}   /* namespace ns3 */
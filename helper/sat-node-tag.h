@@ -16,74 +16,65 @@
 
 #include "ns3/object.h"
 #include "ns3/node.h"
-#include <unordered_map>
 
 #include "ns3/sat-isl-def.h"
+#include "sat-node-registry.h"
 
 
 namespace ns3
 {
 
+    /**
+     * @brief Satellite Identity of a Node
+     *
+     *        The static Queries forward to the SatelliteRegistry of the current Simulation.
+     */
     class SatelliteNodeTag : public Object
     {
     public:
 
-        typedef std::unordered_map<cstid_t, std::vector<orbid_t>>              ConstOrbitMap;
-        typedef std::unordered_map<cstid_t, std::vector<orbid_t>>::iterator    ConstOrbitMapIter;
-
-        typedef std::unordered_map<orbid_t, std::vector<satid_t>>              OrbitSatMap;
-        typedef std::unordered_map<orbid_t, std::vector<satid_t>>::iterator    OrbitSatMapIter;
-
-        typedef std::unordered_map<satid_t, Ptr<SatelliteNodeTag>>             SatNodeMap;
-        typedef std::unordered_map<satid_t, Ptr<SatelliteNodeTag>>::iterator   SatNodeMapIter;
-
-
         static TypeId GetTypeId();
 
         /**
          * @brief Get Number of Registered Constellations
          * 
-         * @return uint16_t 
+         * @return size_t 
          */
-        static uint16_t GetConstellationsN();
+        static size_t GetConstellationsN();
 
         /**
          * @brief Get Number of Registered Orbits
          * 
-         * @return uint16_t 
+         * @return size_t 
          */
-        static uint16_t GetOrbitsN();
+        static size_t GetOrbitsN();
 
         /**
          * @brief Get Number of Registered Orbits by Constellation
          * 
          * @param constellationID 
-         * @return uint16_t 
+         * @return size_t 
          */
-        static uint16_t GetOrbitsN(const uint8_t constellationID);
+        static size_t GetOrbitsN(const cstid_t constellationID);
 
         /**
          * @brief Get Number of Registered Satellites
          * 
-         * @return uint16_t 
+         * @return size_t 
          */
-        static uint16_t GetSatsN();
-
-        static uint16_t GetSatsN(const uint8_t constellationID);
-
-        static uint16_t GetSatsN(const uint8_t constellationID, const uint16_t orbitID);
+        static size_t GetSatsN();
 
         /**
          * @brief Get Number of Registered Satellites by Orbit
          * 
          * @param orbitID 
-         * @return uint16_t 
+         * @return size_t 
          */
-        static uint16_t GetSatsN(const uint16_t orbitID);
+        static size_t GetSatsN(const orbid_t orbitID);
 
 
-        static std::vector<satid_t> SatsByOrbit(const orbid_t orbitID);
-        static std::vector<orbid_t> OrbitsByConstellation(const cstid_t constellationID);
+        static const std::vector<satid_t>& SatsByOrbit(const orbid_t orbitID);
+        static const std::vector<orbid_t>& OrbitsByConstellation(const cstid_t constellationID);
         
         static Ptr<Node> GetSatellite(const satid_t id);
 
@@ -94,29 +85,32 @@ namespace ns3
 //        SatelliteNodeTag(size_t ConstellationID, size_t Orbit, size_t SatNo);
         ~SatelliteNodeTag();
 
+        /**
+         * @brief Register to the Registry of the current Simulation
+         */
         void Register();
         void Register(const cstid_t constellationID, const orbid_t orbitID);
 
-        uint16_t GetId() const;
+        /**
+         * @brief Register to a dedicated Registry
+         * 
+         * @param registry 
+         */
+        void Register(Ptr<SatelliteRegistry> registry);
 
-        uint16_t GetOID() const;
+        satid_t GetId() const;
 
-        uint8_t GetCID() const;
+        orbid_t GetOID() const;
 
+        cstid_t GetCID() const;
 
-    protected:
 
-        //typedef std::unordered_map<uint16_t, Ptr<SatelliteNodeTag>> 
+    protected:
 
         cstid_t m_CID;      //! Constellation ID
         orbid_t m_OID;      //! Orbit ID
         satid_t m_id;       //! Spacecraft ID
 
-
-        static ConstOrbitMap m_CmapO;
-        static OrbitSatMap m_OmapS;
-        static SatNodeMap m_globalNodes;
-
     };  /* SatelliteNodeTag */
 
 
@@ -0,0 +1,570 @@
+/**
+ * @brief   Streaming TLE Catalog Loader
+ *
+ * @file    tle-catalog-helper.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "tle-catalog-helper.h"
+#include "sat-node-tag.h"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/integer.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
+#include "ns3/pseudo-tle.h"
+#include "ns3/sat-circular-orbit-mobility-model.h"
+#include "ns3/sat-hermite-mobility-model.h"
+#include "ns3/satellite-sgp4-mobility-model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <thread>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("TleCatalogHelper");
+    NS_OBJECT_ENSURE_REGISTERED(TleCatalogHelper);
+
+
+    static const double CATALOG_GM = 3.986004418e14;            //! Gravitational Parameter in m^3/s^2
+    static const double CATALOG_RADIUS_EQ = 6378137.0;          //! Equatorial Radius in m
+    static const double CATALOG_J2 = 1.08262668e-3;             //! Second zonal Harmonic
+    static const double CATALOG_SECS_PER_DAY = 86400.0;
+    static const size_t TLE_LINE_LENGTH = 69;
+
+
+    TypeId TleCatalogHelper::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::TleCatalogHelper")
+            .SetParent<Object>()
+            .AddConstructor<TleCatalogHelper>()
+            .AddAttribute(
+                "ConstellationID"
+                , "Constellation ID of the first Shell, the following Shells count up"
+                , IntegerValue(1)
+                , MakeIntegerAccessor(&TleCatalogHelper::m_firstCID)
+                , MakeIntegerChecker<uint8_t>(1, 255)
+            )
+            .AddAttribute(
+                "InclinationTolerance"
+                , "Max. Inclination Gap between Satellites of one Shell in Degree"
+                , DoubleValue(0.5)
+                , MakeDoubleAccessor(&TleCatalogHelper::m_incTolerance)
+                , MakeDoubleChecker<double>(0.0)
+            )
+            .AddAttribute(
+                "AltitudeTolerance"
+                , "Max. Altitude Gap between Satellites of one Shell in km"
+                , DoubleValue(5.0)
+                , MakeDoubleAccessor(&TleCatalogHelper::m_altTolerance)
+                , MakeDoubleChecker<double>(0.0)
+            )
+            .AddAttribute(
+                "RaanTolerance"
+                , "Max. Gap of the Ascending Node between Satellites of one Plane in Degree"
+                , DoubleValue(1.5)
+                , MakeDoubleAccessor(&TleCatalogHelper::m_raanTolerance)
+                , MakeDoubleChecker<double>(0.0, 360.0)
+            )
+            .AddAttribute(
+                "MobilityModel"
+                , "Propagator of the Satellites: SGP4 from the TLE, the analytic circular Orbit or Hermite Samples of it"
+                , EnumValue(WalkerOrbitHelper::MOBILITY_SGP4)
+                , MakeEnumAccessor(&TleCatalogHelper::m_mobilityType)
+                , MakeEnumChecker(
+                    WalkerOrbitHelper::MOBILITY_SGP4, "SGP4",
+                    WalkerOrbitHelper::MOBILITY_CIRCULAR, "CircularOrbit",
+                    WalkerOrbitHelper::MOBILITY_HERMITE, "HermiteCircularOrbit"
+                )
+            )
+            .AddAttribute(
+                "Threads"
+                , "Number of Threads to parse and normalise the Elements, zero uses all Cores"
+                , UintegerValue(0)
+                , MakeUintegerAccessor(&TleCatalogHelper::m_threads)
+                , MakeUintegerChecker<uint32_t>()
+            )
+            .AddAttribute(
+                "EphemerisStep"
+                , "Propagate all Satellites in one batched Pass per Step into a shared Ephemeris Table, zero disables the Table"
+                , TimeValue(Time(0))
+                , MakeTimeAccessor(&TleCatalogHelper::m_ephemerisStep)
+                , MakeTimeChecker(Time(0))
+            )
+        ;
+
+        return tid;
+    }
+
+
+    TleCatalogHelper::TleCatalogHelper()
+    : m_incTolerance(0.5)
+    , m_altTolerance(5.0)
+    , m_raanTolerance(1.5)
+    , m_firstCID(1)
+    , m_threads(0)
+    , m_ephemerisStep(Time(0))
+    , m_mobilityType(WalkerOrbitHelper::MOBILITY_SGP4)
+    , m_ephemeris(nullptr)
+    , m_rejected(0)
+    , m_earthAngle(0.0)
+    {
+    }
+
+
+    TleCatalogHelper::~TleCatalogHelper()
+    {
+    }
+
+
+    size_t TleCatalogHelper::Load(const std::string &filename)
+    {
+        NS_LOG_FUNCTION(this << filename);
+
+        std::ifstream in(filename);
+        NS_ABORT_MSG_IF(!in.is_open(), "Cannot open TLE Catalog " << filename);
+
+        return Load(in);
+    }
+
+
+    size_t TleCatalogHelper::Load(std::istream &in)
+    {
+        NS_LOG_FUNCTION(this);
+
+        size_t first = m_records.size();
+
+        std::string line;
+        line.reserve(128);
+
+        Record rec;
+        rec.name[0] = '\0';
+        bool have_line1 = false;
+
+        while (std::getline(in, line))
+        {
+            size_t len = line.size();
+            while (len > 0 && (line[len - 1] == '\r' || line[len - 1] == ' ')) len--;
+            if (len == 0) continue;
+
+            const char *s = line.c_str();
+
+            if (len >= TLE_LINE_LENGTH && s[0] == '1' && s[1] == ' ')
+            {
+                std::memcpy(rec.line1, s, TLE_LINE_LENGTH);
+                rec.line1[TLE_LINE_LENGTH] = '\0';
+                have_line1 = true;
+                continue;
+            }
+
+            if (len >= TLE_LINE_LENGTH && s[0] == '2' && s[1] == ' ' && have_line1)
+            {
+                std::memcpy(rec.line2, s, TLE_LINE_LENGTH);
+                rec.line2[TLE_LINE_LENGTH] = '\0';
+
+                // Parsed in parallel once the Stream is read
+                m_records.push_back(rec);
+
+                rec.name[0] = '\0';
+                have_line1 = false;
+                continue;
+            }
+
+            // Name Line of a 3LE, optionally with the "0 " Prefix
+            if (s[0] == '0' && s[1] == ' ')
+            {
+                s += 2;
+                len -= 2;
+            }
+
+            len = std::min(len, sizeof(rec.name) - 1);
+            std::memcpy(rec.name, s, len);
+            rec.name[len] = '\0';
+            have_line1 = false;
+        }
+
+        std::vector<uint8_t> valid(m_records.size() - first);
+        _parallel(valid.size(), [this, &valid, first](size_t begin, size_t end) {
+            for (size_t n = begin; n < end; n++)
+            {
+                valid[n] = _parse(m_records[first + n]);
+            }
+        });
+
+        // Drop the rejected Entries, keeping the Order of the Catalog
+        size_t kept = first;
+        for (size_t n = 0; n < valid.size(); n++)
+        {
+            if (valid[n]) m_records[kept++] = m_records[first + n];
+            else m_rejected++;
+        }
+        m_records.resize(kept);
+
+        NS_LOG_INFO("Loaded " << m_records.size() - first << " Satellites, rejected " << m_rejected << " Entries");
+
+        return m_records.size() - first;
+    }
+
+
+    void TleCatalogHelper::Initialize()
+    {
+        NS_LOG_FUNCTION(this << m_records.size());
+
+        size_t N = m_records.size();
+
+        _cluster();
+
+        // Object Creation is not thread-safe, all Objects are built on the Simulator Thread
+        if (m_ephemerisStep.IsStrictlyPositive())
+        {
+            m_ephemeris = CreateObjectWithAttributes<SatEphemerisTable>("Step", TimeValue(m_ephemerisStep));
+        }
+
+        orbid_t first_oid = SatelliteRegistry::Get()->GetMaxOrbitId() + 1;
+
+        for (size_t n = 0; n < N; n++)
+        {
+            const Record &rec = m_records[m_order[n]];
+
+            Ptr<SatelliteNodeTag> sat_tag = CreateObjectWithAttributes<SatelliteNodeTag>(
+                "ConstellationID", IntegerValue(m_firstCID + m_shellOfPlane[rec.plane]),
+                "OrbitID", IntegerValue(first_oid + rec.plane)
+            );
+            sat_tag->Register();
+
+            Ptr<PseudoSatTLE> sat = CreateObject<PseudoSatTLE>();
+            sat->SetElements(rec.elements);
+
+            Ptr<MobilityModel> sat_mob = _createMobility(rec);
+
+            if (m_ephemeris != nullptr)
+            {
+                sat_mob = m_ephemeris->CreateMobilityModel(m_ephemeris->Add(sat_mob));
+            }
+
+            m_sats.push_back(sat_mob);
+
+            Ptr<Node> node = CreateObject<Node>();
+            node->AggregateObject(sat_mob);
+            node->AggregateObject(sat);
+            node->AggregateObject(sat_tag);
+
+            m_nodes.Add(node);
+        }
+
+        NS_LOG_INFO(N << " Satellites in " << getShellCount() << " Shells and " << getPlaneCount() << " Planes");
+    }
+
+
+    size_t TleCatalogHelper::getSatelliteCount() const
+    {
+        return m_sats.size();
+    }
+
+
+    Ptr<MobilityModel> TleCatalogHelper::getSatellite(size_t satIndex) const
+    {
+        if (satIndex >= m_sats.size())
+            return nullptr;
+
+        return m_sats[satIndex];
+    }
+
+
+    std::string TleCatalogHelper::getSatelliteName(size_t satIndex) const
+    {
+        if (satIndex >= m_order.size())
+            return "";
+
+        const Record &rec = m_records[m_order[satIndex]];
+        if (rec.name[0] != '\0')
+            return rec.name;
+
+        return std::to_string(rec.elements.satNo);
+    }
+
+
+    NodeContainer TleCatalogHelper::getSatellites() const
+    {
+        return m_nodes;
+    }
+
+
+    size_t TleCatalogHelper::getShellCount() const
+    {
+        if (m_shellOfPlane.empty())
+            return 0;
+
+        return m_shellOfPlane.back() + 1;
+    }
+
+
+    size_t TleCatalogHelper::getPlaneCount() const
+    {
+        return m_shellOfPlane.size();
+    }
+
+
+    Ptr<SatEphemerisTable> TleCatalogHelper::getEphemerisTable() const
+    {
+        return m_ephemeris;
+    }
+
+
+    bool TleCatalogHelper::_parse(Record &rec) const
+    {
+        if (!_checksum(rec.line1) || !_checksum(rec.line2))
+            return false;
+
+        // Both Lines have to describe the same Satellite
+        if (std::memcmp(rec.line1 + 2, rec.line2 + 2, 5) != 0)
+            return false;
+
+        SatOrbitalElements &el = rec.elements;
+
+        el.satNo = (int) _field(rec.line1, 2, 5);
+        el.epochYear = (int) _field(rec.line1, 18, 2);
+        el.epochDay = _field(rec.line1, 20, 12);
+
+        el.inclination = _field(rec.line2, 8, 8);
+        el.raan = _field(rec.line2, 17, 8);
+        el.eccentricity = _field(rec.line2, 26, 7) * 1e-7;
+        el.perigee = _field(rec.line2, 34, 8);
+        el.meanAnomaly = _field(rec.line2, 43, 8);
+        el.meanMotion = _field(rec.line2, 52, 11);
+
+        if (el.meanMotion <= 0.0)
+            return false;
+
+        double n = el.meanMotion * 2.0 * M_PI / CATALOG_SECS_PER_DAY;
+        double a = std::cbrt(CATALOG_GM / (n * n));
+
+        rec.epoch = _epochDays(el.epochYear, el.epochDay);
+        rec.inclination = el.inclination;
+        rec.altitude = (a - CATALOG_RADIUS_EQ) / 1000.0;
+        rec.raan = el.raan;
+        rec.latitude = el.perigee + el.meanAnomaly;
+        rec.plane = 0;
+
+        return true;
+    }
+
+
+    bool TleCatalogHelper::_checksum(const char *line)
+    {
+        int sum = 0;
+        for (size_t n = 0; n < TLE_LINE_LENGTH - 1; n++)
+        {
+            if (line[n] >= '0' && line[n] <= '9') sum += line[n] - '0';
+            else if (line[n] == '-') sum += 1;
+        }
+
+        return (sum % 10) == (line[TLE_LINE_LENGTH - 1] - '0');
+    }
+
+
+    double TleCatalogHelper::_field(const char *line, const size_t begin, const size_t len)
+    {
+        char buf[16];
+        std::memcpy(buf, line + begin, len);
+        buf[len] = '\0';
+
+        return std::strtod(buf, nullptr);
+    }
+
+
+    double TleCatalogHelper::_epochDays(const int year, const double day)
+    {
+        // Two-digit TLE Years: 57-99 are 1957-1999, 00-56 are 2000-2056
+        int y = (year < 57) ? 2000 + year : 1900 + year;
+
+        double days = day - 1.0;
+        for (int n = 1950; n < y; n++)
+        {
+            days += ((n % 4 == 0 && n % 100 != 0) || n % 400 == 0) ? 366.0 : 365.0;
+        }
+
+        return days;
+    }
+
+
+    std::vector<size_t> TleCatalogHelper::_split(const size_t begin, const size_t end, double Record::*key, const double tolerance, const bool circular)
+    {
+        auto first = m_order.begin() + begin;
+        auto last = m_order.begin() + end;
+
+        std::sort(first, last, [this, key](size_t a, size_t b) { return m_records[a].*key < m_records[b].*key; });
+
+        // A circular Key starts after its largest Gap, so no Cluster is cut at 0/360 deg
+        if (circular && end - begin > 1)
+        {
+            size_t cut = begin;
+            double gap = m_records[m_order[begin]].*key + 360.0 - m_records[m_order[end - 1]].*key;
+
+            for (size_t n = begin + 1; n < end; n++)
+            {
+                double d = m_records[m_order[n]].*key - m_records[m_order[n - 1]].*key;
+                if (d > gap)
+                {
+                    gap = d;
+                    cut = n;
+                }
+            }
+
+            std::rotate(first, m_order.begin() + cut, last);
+        }
+
+        std::vector<size_t> bounds = {begin};
+
+        for (size_t n = begin + 1; n < end; n++)
+        {
+            double d = m_records[m_order[n]].*key - m_records[m_order[n - 1]].*key;
+            if (circular && d < 0.0) d += 360.0;
+
+            if (d > tolerance) bounds.push_back(n);
+        }
+
+        bounds.push_back(end);
+        return bounds;
+    }
+
+
+    void TleCatalogHelper::_parallel(const size_t N, const std::function<void(size_t, size_t)> &job) const
+    {
+        size_t threads = (m_threads > 0) ? m_threads : std::max(1u, std::thread::hardware_concurrency());
+        threads = std::max<size_t>(1, std::min(threads, N));
+
+        std::vector<std::thread> workers;
+        for (size_t t = 1; t < threads; t++)
+        {
+            workers.emplace_back(job, (N * t) / threads, (N * (t + 1)) / threads);
+        }
+
+        job(0, N / threads);
+
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+
+    void TleCatalogHelper::_normalize(Record &rec, const double ref_epoch)
+    {
+        const SatOrbitalElements &el = rec.elements;
+
+        double n = el.meanMotion * 2.0 * M_PI / CATALOG_SECS_PER_DAY;
+        double a = std::cbrt(CATALOG_GM / (n * n));
+        double cos_i = std::cos(el.inclination * M_PI / 180.0);
+        double k = 0.75 * CATALOG_J2 * std::pow(CATALOG_RADIUS_EQ / a, 2.0) * n;
+
+        double dt = (ref_epoch - rec.epoch) * CATALOG_SECS_PER_DAY;
+        double raan_rate = -2.0 * k * cos_i;
+        double lat_rate = n + k * (5.0 * cos_i * cos_i - 1.0) + k * (3.0 * cos_i * cos_i - 1.0);
+
+        rec.raan = std::fmod(el.raan + raan_rate * dt * 180.0 / M_PI, 360.0);
+        rec.latitude = std::fmod(el.perigee + el.meanAnomaly + lat_rate * dt * 180.0 / M_PI, 360.0);
+        if (rec.raan < 0.0) rec.raan += 360.0;
+        if (rec.latitude < 0.0) rec.latitude += 360.0;
+    }
+
+
+    void TleCatalogHelper::_cluster()
+    {
+        size_t N = m_records.size();
+        if (N == 0) return;
+
+        // Move Node and Latitude of all Satellites to the latest Epoch of the Catalog
+        double ref_epoch = 0.0;
+        for (const Record &rec : m_records)
+        {
+            if (rec.epoch < ref_epoch) continue;
+
+            ref_epoch = rec.epoch;
+            m_earthAngle = SatCircularOrbitMobilityModel::EarthRotationAngleAt(rec.elements.epochYear, rec.elements.epochDay);
+        }
+
+        _parallel(N, [this, ref_epoch](size_t begin, size_t end) {
+            for (size_t n = begin; n < end; n++)
+            {
+                _normalize(m_records[n], ref_epoch);
+            }
+        });
+
+        m_order.resize(N);
+        std::iota(m_order.begin(), m_order.end(), 0);
+        m_shellOfPlane.clear();
+
+        // Inclination Groups, split by Altitude into Shells, split by the Node into Planes
+        std::vector<size_t> inc_bounds = _split(0, N, &Record::inclination, m_incTolerance, false);
+
+        for (size_t i = 0; i + 1 < inc_bounds.size(); i++)
+        {
+            std::vector<size_t> alt_bounds = _split(inc_bounds[i], inc_bounds[i + 1], &Record::altitude, m_altTolerance, false);
+
+            for (size_t s = 0; s + 1 < alt_bounds.size(); s++)
+            {
+                size_t shell = getShellCount();
+                NS_ABORT_MSG_IF(m_firstCID + shell > UINT8_MAX, "Too many Shells for the 8 bit Constellation IDs");
+
+                std::vector<size_t> raan_bounds = _split(alt_bounds[s], alt_bounds[s + 1], &Record::raan, m_raanTolerance, true);
+
+                for (size_t p = 0; p + 1 < raan_bounds.size(); p++)
+                {
+                    uint32_t plane = m_shellOfPlane.size();
+                    m_shellOfPlane.push_back(shell);
+
+                    // Order the Plane along the Orbit
+                    _split(raan_bounds[p], raan_bounds[p + 1], &Record::latitude, 360.0, false);
+
+                    for (size_t n = raan_bounds[p]; n < raan_bounds[p + 1]; n++)
+                    {
+                        m_records[m_order[n]].plane = plane;
+                    }
+                }
+            }
+        }
+    }
+
+
+    Ptr<MobilityModel> TleCatalogHelper::_createMobility(const Record &rec) const
+    {
+        if (m_mobilityType == WalkerOrbitHelper::MOBILITY_SGP4)
+        {
+            Ptr<SatSGP4MobilityModel> sgp4 = CreateObject<SatSGP4MobilityModel>();
+            sgp4->SetTleInfo(std::string(rec.line1) + "\n" + rec.line2);
+            return sgp4;
+        }
+
+        // Time Zero of the analytic Orbit is the Reference Epoch of the Clustering
+        Ptr<SatCircularOrbitMobilityModel> orbit = CreateObject<SatCircularOrbitMobilityModel>();
+        orbit->SetOrbitalElements(rec.elements.inclination, rec.raan, rec.latitude, rec.elements.meanMotion);
+        orbit->SetEarthRotationAngle(m_earthAngle);
+
+        if (m_mobilityType == WalkerOrbitHelper::MOBILITY_HERMITE)
+        {
+            Ptr<SatHermiteMobilityModel> hermite = CreateObject<SatHermiteMobilityModel>();
+            hermite->SetReference(orbit);
+            return hermite;
+        }
+
+        return orbit;
+    }
+
+
+}   /* namespace ns3 */
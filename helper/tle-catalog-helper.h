@@ -0,0 +1,184 @@
+/**
+ * @brief   Streaming TLE Catalog Loader
+ *
+ * @file    tle-catalog-helper.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef TLE_CATALOG_HELPER_H
+#define TLE_CATALOG_HELPER_H
+
+
+#include "ns3/object.h"
+#include "ns3/node-container.h"
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+
+#include "ns3/sat-orbital-elements.h"
+#include "ns3/sat-ephemeris-table.h"
+#include "walker-orbit-helper.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+
+namespace ns3
+{
+
+    /**
+     * @brief Load real Satellites from a TLE / 3LE Catalog
+     *
+     *        The Catalog is read Line by Line into fixed-size Records. Shells are found by
+     *        clustering Inclination and Altitude, Planes within a Shell by clustering the
+     *        Ascending Node (normalised to a common Epoch with the J2 Drift). Each Shell gets
+     *        a ConstellationID and each Plane an OrbitID, the Satellites of a Plane are ordered
+     *        by their Argument of Latitude.
+     *
+     *        Parsing the Records and normalising their Elements to the common Epoch run in
+     *        parallel on plain Data. All ns-3 Objects (Propagators, Nodes, Tags) are created
+     *        afterwards on the calling Thread, so the Result looks like a WalkerConstellationHelper Setup.
+     */
+    class TleCatalogHelper : public Object
+    {
+    public:
+
+        static TypeId GetTypeId();
+
+        TleCatalogHelper();
+        ~TleCatalogHelper();
+
+
+        /**
+         * @brief Parse a Catalog File, can be called several Times before Initialize
+         *
+         * @param filename  Path of the TLE / 3LE File
+         * @return size_t   Number of accepted Satellites
+         */
+        size_t Load(const std::string &filename);
+
+        /**
+         * @brief Parse a Catalog from a Stream
+         */
+        size_t Load(std::istream &in);
+
+        /**
+         * @brief Cluster the loaded Satellites and create the Nodes
+         */
+        void Initialize();
+
+
+        size_t getSatelliteCount() const;
+
+        /**
+         * @brief Get the Satellite object
+         *
+         * @param satIndex  Satellite Index (starting at 0, ordered by Shell, Plane and Latitude)
+         * @return Ptr<MobilityModel>
+         */
+        Ptr<MobilityModel> getSatellite(size_t satIndex) const;
+
+        /**
+         * @brief Get the Catalog Name of a Satellite (3LE Name Line or Catalog Number)
+         */
+        std::string getSatelliteName(size_t satIndex) const;
+
+        NodeContainer getSatellites() const;
+
+        /**
+         * @brief Get the Number of Shells (Constellation IDs) found by the Clustering
+         */
+        size_t getShellCount() const;
+
+        /**
+         * @brief Get the Number of Planes (Orbit IDs) found by the Clustering
+         */
+        size_t getPlaneCount() const;
+
+        Ptr<SatEphemerisTable> getEphemerisTable() const;
+
+
+    private:
+
+        /**
+         * @brief One Catalog Entry, fixed-size to keep the Parser free of Allocations
+         */
+        struct Record
+        {
+            char name[25];              //!< 3LE Name, empty for plain TLE
+            char line1[70];             //!< TLE Line 1
+            char line2[70];             //!< TLE Line 2
+            SatOrbitalElements elements;
+            double epoch;               //!< Epoch in Days since 1950
+            double inclination;         //!< Inclination in Degree
+            double raan;                //!< Ascending Node at the Reference Epoch in Degree
+            double latitude;            //!< Argument of Latitude at the Reference Epoch in Degree
+            double altitude;            //!< Altitude in km
+            uint32_t plane;             //!< Plane Index after the Clustering
+        };
+
+
+        bool _parse(Record &rec) const;
+
+        static bool _checksum(const char *line);
+
+        static double _field(const char *line, const size_t begin, const size_t len);
+
+        static double _epochDays(const int year, const double day);
+
+
+        /**
+         * @brief Split [begin, end) of m_order into Clusters by the Gaps of a Key
+         *
+         * @return std::vector<size_t>   Boundaries of the Clusters in m_order
+         */
+        std::vector<size_t> _split(const size_t begin, const size_t end, double Record::*key, const double tolerance, const bool circular);
+
+        /**
+         * @brief Run a Job over [0, N) split into Chunks on m_threads Threads, for plain Data only
+         */
+        void _parallel(const size_t N, const std::function<void(size_t, size_t)> &job) const;
+
+        /**
+         * @brief Move Node and Latitude of a Record to the Reference Epoch with the J2 Drift
+         */
+        static void _normalize(Record &rec, const double ref_epoch);
+
+        void _cluster();
+
+        Ptr<MobilityModel> _createMobility(const Record &rec) const;
+
+
+        double m_incTolerance;          //!< Max. Inclination Gap within a Shell in Degree
+        double m_altTolerance;          //!< Max. Altitude Gap within a Shell in km
+        double m_raanTolerance;         //!< Max. Ascending Node Gap within a Plane in Degree
+        uint8_t m_firstCID;             //!< Constellation ID of the first Shell
+        uint32_t m_threads;             //!< Threads for Parsing and Normalisation, zero for all Cores
+        Time m_ephemerisStep;           //!< Step of the Ephemeris Table, zero to disable
+
+        WalkerOrbitHelper::walkerMobilityModel_t m_mobilityType;    //! Propagator of the Satellites
+
+        std::vector<Record> m_records;                  //!< Parsed Catalog
+        std::vector<size_t> m_order;                    //!< Record Index by Satellite Index
+        std::vector<uint8_t> m_shellOfPlane;            //!< Shell Index by Plane Index
+
+        std::vector<Ptr<MobilityModel>> m_sats;         //!< Aggregated Mobility by Satellite Index
+        NodeContainer m_nodes;
+        Ptr<SatEphemerisTable> m_ephemeris;             //!< Batch Propagation of all Satellites
+
+        size_t m_rejected;                              //!< Entries with a bad Checksum or Format
+        double m_earthAngle;                            //!< Earth Rotation Angle at the Reference Epoch in Degree
+
+    };  /* TleCatalogHelper */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* TLE_CATALOG_HELPER_H */
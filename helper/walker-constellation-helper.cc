@@ -5,11 +5,17 @@
 #include <ns3/double.h>
 #include <ns3/integer.h>
 #include <ns3/enum.h>
+#include <ns3/nstime.h>
+#include <ns3/string.h>
 
 #include <math.h>
+#include <iomanip>
+#include <sstream>
 
 #include "walker-constellation-helper.h"
 #include "sat-node-tag.h"
+#include "ns3/sat-circular-orbit-mobility-model.h"
+#include "ns3/sat-hermite-mobility-model.h"
 
 NS_LOG_COMPONENT_DEFINE("WalkerConstellationHelper");
 
@@ -24,6 +30,9 @@ const double WalkerConstellationHelper::secsPerDay =86400.0;
 const double WalkerConstellationHelper::twoPi = 6.2831853072;
 const double WalkerConstellationHelper::meanEarthRadius = 6371.0;
 
+//! Format of the Ephemeris Cache Key, increment whenever the Propagation changes
+static const uint32_t WALKER_EPHEMERIS_KEY_VERSION = 2;
+
 
 TypeId WalkerConstellationHelper::GetTypeId (void) 
 {
@@ -74,6 +83,30 @@ TypeId WalkerConstellationHelper::GetTypeId (void)
                       IntegerValue(1),
                       MakeIntegerAccessor(&WalkerConstellationHelper::m_CID),
                       MakeIntegerChecker<uint8_t>(1))
+        .AddAttribute("MobilityModel",
+                      "Propagator of the Satellites: SGP4 from a Pseudo TLE, the analytic circular Orbit or Hermite Samples of it",
+                      EnumValue(WalkerOrbitHelper::MOBILITY_SGP4),
+                      MakeEnumAccessor(&WalkerConstellationHelper::m_mobilityType),
+                      MakeEnumChecker(
+                        WalkerOrbitHelper::MOBILITY_SGP4, "SGP4",
+                        WalkerOrbitHelper::MOBILITY_CIRCULAR, "CircularOrbit",
+                        WalkerOrbitHelper::MOBILITY_HERMITE, "HermiteCircularOrbit"
+                      ))
+        .AddAttribute("EphemerisStep",
+                      "Propagate all Satellites in one batched Pass per Step into a shared Ephemeris Table, zero disables the Table",
+                      TimeValue(Time(0)),
+                      MakeTimeAccessor(&WalkerConstellationHelper::m_ephemerisStep),
+                      MakeTimeChecker(Time(0)))
+        .AddAttribute("EphemerisCache",
+                      "Directory of the on-disk Ephemeris Cache, empty disables the Cache (needs an EphemerisStep)",
+                      StringValue(""),
+                      MakeStringAccessor(&WalkerConstellationHelper::m_ephemerisCache),
+                      MakeStringChecker())
+        .AddAttribute("EphemerisSpan",
+                      "Simulation Time covered by the Ephemeris Cache",
+                      TimeValue(Seconds(600)),
+                      MakeTimeAccessor(&WalkerConstellationHelper::m_ephemerisSpan),
+                      MakeTimeChecker(Time(0)))
     ;
     return tid;
 }
@@ -89,6 +122,20 @@ WalkerConstellationHelper::WalkerConstellationHelper (void)
     NS_LOG_FUNCTION(this);
 }
 
+void WalkerConstellationHelper::DoDispose (void)
+{
+    NS_LOG_FUNCTION(this);
+
+    // The Table may outlive the Helper, its Factory holds a raw Pointer to it
+    if (m_ephemeris != nullptr)
+    {
+        m_ephemeris->SetSourceFactory(Callback<Ptr<MobilityModel>, uint32_t>());
+    }
+
+    m_ephemeris = nullptr;
+    Object::DoDispose();
+}
+
 void WalkerConstellationHelper::Initialize (void) 
 {
     NS_LOG_FUNCTION(this);
@@ -100,6 +147,11 @@ void WalkerConstellationHelper::Initialize (void)
 
     double phase = 0.0;
 
+    if (m_ephemerisStep.IsStrictlyPositive())
+    {
+        m_ephemeris = CreateObjectWithAttributes<SatEphemerisTable>("Step", TimeValue(m_ephemerisStep));
+    }
+
 
     for (int i = 0; i < m_numPlanes; i++)
     {
@@ -111,10 +163,12 @@ void WalkerConstellationHelper::Initialize (void)
             "MeanMotion", DoubleValue(getMeanMotion()),
             "Phase", DoubleValue(phase),
             "ConstellationID", IntegerValue(m_CID),
-            "OrbitID", IntegerValue(SatelliteNodeTag::GetOrbitsN()+1)
+            "OrbitID", IntegerValue(SatelliteRegistry::Get()->GetMaxOrbitId()+1),
+            "MobilityModel", EnumValue(m_mobilityType)
         );
 
-        orb->Initialize(N);
+        // With a Cache File the Propagators are only built once the Table leaves a replayed Span
+        orb->Initialize(N, m_ephemeris, m_ephemeris != nullptr && !m_ephemerisCache.empty());
         m_orbits.push_back(orb);
 
 
@@ -133,6 +187,18 @@ void WalkerConstellationHelper::Initialize (void)
 
     m_totSats = N;
 
+    if (m_ephemeris != nullptr && !m_ephemerisCache.empty())
+    {
+        m_ephemeris->SetSourceFactory(MakeCallback(&WalkerConstellationHelper::_createPropagator, this));
+
+        uint64_t key = SatEphemerisCache::Hash(_getEphemerisKey());
+
+        std::ostringstream path;
+        path << m_ephemerisCache << "/walker-" << std::hex << std::setw(16) << std::setfill('0') << key << ".eph";
+
+        m_ephemeris->SetCache(path.str(), key, m_ephemerisSpan);
+    }
+
 }
 
 void WalkerConstellationHelper::LogInitialPositions (const std::string prefix, const std::string postfix)
@@ -189,6 +255,106 @@ Ptr<MobilityModel> WalkerConstellationHelper::getSatellite (unsigned long satInd
 }
 
 
+WalkerConstellationHelper::walkerConstellationType_t WalkerConstellationHelper::getType (void) const
+{
+    return m_type;
+}
+
+double WalkerConstellationHelper::getInclination (void) const
+{
+    return m_inclination;
+}
+
+double WalkerConstellationHelper::getPhasing (void) const
+{
+    return m_phasing;
+}
+
+int WalkerConstellationHelper::getOrbitCount (void) const
+{
+    return m_orbits.size();
+}
+
+Ptr<WalkerOrbitHelper> WalkerConstellationHelper::getOrbit (unsigned int orbIndex) const
+{
+    if (orbIndex >= m_orbits.size())
+        return nullptr;
+
+    return m_orbits.at(orbIndex);
+}
+
+
+Ptr<SatEphemerisTable> WalkerConstellationHelper::getEphemerisTable() const
+{
+    return m_ephemeris;
+}
+
+
+std::string WalkerConstellationHelper::_getEphemerisKey() const
+{
+    std::ostringstream oss;
+    oss << std::setprecision(17)
+        << "version=" << WALKER_EPHEMERIS_KEY_VERSION
+        << ";type=" << m_type
+        << ";mobility=" << m_mobilityType
+        << ";inclination=" << m_inclination
+        << ";altitude=" << m_altitude
+        << ";planes=" << m_numPlanes
+        << ";sats=" << m_numSats
+        << ";phasing=" << m_phasing
+        << ";raan=" << m_raanShift
+        << ";step=" << m_ephemerisStep.GetNanoSeconds()
+        << ";span=" << m_ephemerisSpan.GetNanoSeconds();
+
+    // Epoch of the Elements, the Circular Orbit derives its Earth Rotation Angle from it
+    SatOrbitalElements elements;
+    oss << ";epoch=" << elements.epochYear << "/" << elements.epochDay;
+
+    // Attribute Defaults of the Propagators (J2, Earth Frame, Hermite Interval and Tolerance, SGP4 Start Date)
+    if (m_mobilityType == WalkerOrbitHelper::MOBILITY_SGP4)
+    {
+        oss << _getAttributeKey(SatSGP4MobilityModel::GetTypeId());
+    }
+    else
+    {
+        oss << _getAttributeKey(SatCircularOrbitMobilityModel::GetTypeId());
+    }
+
+    if (m_mobilityType == WalkerOrbitHelper::MOBILITY_HERMITE)
+    {
+        oss << _getAttributeKey(SatHermiteMobilityModel::GetTypeId());
+    }
+
+    return oss.str();
+}
+
+
+std::string WalkerConstellationHelper::_getAttributeKey(const TypeId tid)
+{
+    std::ostringstream oss;
+
+    // Initial Values include all Config::SetDefault Overrides
+    for (TypeId t = tid; t != t.GetParent(); t = t.GetParent())
+    {
+        for (std::size_t n = 0; n < t.GetAttributeN(); n++)
+        {
+            TypeId::AttributeInformation info = t.GetAttribute(n);
+            if (!(info.flags & TypeId::ATTR_CONSTRUCT)) continue;
+
+            oss << ";" << t.GetName() << "::" << info.name << "=" << info.initialValue->SerializeToString(info.checker);
+        }
+    }
+
+    return oss.str();
+}
+
+
+Ptr<MobilityModel> WalkerConstellationHelper::_createPropagator(uint32_t id)
+{
+    return m_orbits.at(id / m_numSats)->CreatePropagator(id % m_numSats);
+}
+
+
 double WalkerConstellationHelper::_getRaanShift() const
 {
     switch (m_type)
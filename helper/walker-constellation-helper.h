@@ -139,14 +139,81 @@ public:
      */
     Ptr<MobilityModel> getSatellite(unsigned long satIndex) const;
 
+    /**
+     * @brief Get the Walker Type (the Seam of Star and Polar Constellations is counter-rotating)
+     * 
+     * @return walkerConstellationType_t 
+     */
+    walkerConstellationType_t getType (void) const;
+
+    double getInclination (void) const;
+
+    /**
+     * @brief Get the Phase Shift between neighbouring Planes in Degree
+     * 
+     * @return double 
+     */
+    double getPhasing (void) const;
+
+    /**
+     * @brief Get the Number of orbital Planes
+     * 
+     * @return int 
+     */
+    int getOrbitCount (void) const;
+
+    /**
+     * @brief Get the Orbit object
+     * 
+     * @param orbIndex  Plane Index (starting at 0, ordered by Ascending Node)
+     * @return Ptr<WalkerOrbitHelper> 
+     */
+    Ptr<WalkerOrbitHelper> getOrbit (unsigned int orbIndex) const;
+
+    /**
+     * @brief Get the shared Ephemeris Table
+     * 
+     * @return Ptr<SatEphemerisTable>   nullptr if the EphemerisStep is zero
+     */
+    Ptr<SatEphemerisTable> getEphemerisTable() const;
+
+protected:
+
+    void DoDispose() override;
+
 private:
 
     double _getRaanShift() const;
 
+    /**
+     * @brief Get the Parameters the Satellite States depend on, hashed as Key of the Ephemeris Cache
+     * 
+     * @return std::string 
+     */
+    std::string _getEphemerisKey() const;
+
+    /**
+     * @brief Get all readable Attribute Values of a Propagator Type, with its Parents
+     * 
+     * @param tid   TypeId of the Propagator
+     * @return std::string 
+     */
+    static std::string _getAttributeKey(const TypeId tid);
+
+    /**
+     * @brief Create the Propagator of a deferred Satellite of the Ephemeris Table
+     * 
+     * @param id    Index of the Satellite in the Table
+     * @return Ptr<MobilityModel> 
+     */
+    Ptr<MobilityModel> _createPropagator(uint32_t id);
+
     walkerConstellationType_t m_type;
 
     uint8_t m_CID;              //! Constellation ID
 
+    WalkerOrbitHelper::walkerMobilityModel_t m_mobilityType;   //! Propagator of the Satellites
+
     double m_inclination;
     double m_altitude;
     int m_numPlanes;
@@ -158,6 +225,12 @@ private:
 
     std::vector<Ptr<WalkerOrbitHelper>> m_orbits;
 
+    Time m_ephemerisStep;                       //! Step of the Ephemeris Table, zero to disable
+    Ptr<SatEphemerisTable> m_ephemeris;         //! Batch Propagation of all Satellites
+
+    std::string m_ephemerisCache;               //! Directory of the Ephemeris Cache Files
+    Time m_ephemerisSpan;                       //! Simulation Time covered by a Cache File
+
 };
 
 
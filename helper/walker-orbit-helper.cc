@@ -6,9 +6,12 @@
 #include <ns3/double.h>
 #include <ns3/integer.h>
 #include <ns3/type-id.h>
+#include <ns3/enum.h>
 
 #include "walker-orbit-helper.h"
 #include "ns3/pseudo-tle.h"
+#include "ns3/sat-circular-orbit-mobility-model.h"
+#include "ns3/sat-hermite-mobility-model.h"
 #include "sat-node-tag.h"
 
 
@@ -56,11 +59,20 @@ TypeId WalkerOrbitHelper::GetTypeId (void)
                       MakeIntegerAccessor(&WalkerOrbitHelper::m_CID),
                       MakeIntegerChecker<uint8_t>(1, 255))
         .AddAttribute("OrbitID",
-                      "Orbit ID ( between 1 to 2^16 )",
+                      "Orbit ID ( between 1 to 2^32 )",
                       IntegerValue(1),
                       MakeIntegerAccessor(&WalkerOrbitHelper::m_OID),
-                      MakeIntegerChecker<uint16_t>(1)
+                      MakeIntegerChecker<orbid_t>(1)
         )
+        .AddAttribute("MobilityModel",
+                      "Propagator of the Satellites: SGP4 from a Pseudo TLE, the analytic circular Orbit or Hermite Samples of it",
+                      EnumValue(MOBILITY_SGP4),
+                      MakeEnumAccessor(&WalkerOrbitHelper::m_mobilityType),
+                      MakeEnumChecker(
+                        MOBILITY_SGP4, "SGP4",
+                        MOBILITY_CIRCULAR, "CircularOrbit",
+                        MOBILITY_HERMITE, "HermiteCircularOrbit"
+                      ))
     ;
 
     return tid;
@@ -73,6 +85,7 @@ TypeId WalkerOrbitHelper::GetInstanceTypeId (void) const
 }
 
 WalkerOrbitHelper::WalkerOrbitHelper (void) 
+    : m_mobilityType(MOBILITY_SGP4)
 {
     NS_LOG_FUNCTION (this);
 
@@ -82,7 +95,7 @@ WalkerOrbitHelper::WalkerOrbitHelper (void)
     
 }
 
-void WalkerOrbitHelper::Initialize (unsigned long satNo_seed)
+void WalkerOrbitHelper::Initialize (unsigned long satNo_seed, Ptr<SatEphemerisTable> ephemeris, bool deferred)
 {
     NS_LOG_FUNCTION (this);
 
@@ -100,17 +113,33 @@ void WalkerOrbitHelper::Initialize (unsigned long satNo_seed)
         );
         sat_tag->Register();
 
-        Ptr<PseudoSatTLE> sat = CreateObjectWithAttributes<PseudoSatTLE>(
-            "Inclination", DoubleValue(m_inclination),
-            "SatNo", IntegerValue(sat_tag->GetId()),
-            "MeanAnomaly", DoubleValue(phase),
-            "AscendingNode", DoubleValue(m_raan),
-            "MeanMotion", DoubleValue(m_meanMotion)
-        );
-
-        m_satFactory.SetTypeId("ns3::SatSGP4MobilityModel");
-        Ptr<SatSGP4MobilityModel> sat_mob = m_satFactory.Create<SatSGP4MobilityModel>();
-        sat_mob->SetTleInfo(sat->TleFull());
+        SatOrbitalElements elements;
+        elements.satNo = sat_tag->GetId();
+        elements.inclination = m_inclination;
+        elements.raan = m_raan;
+        elements.meanAnomaly = phase;
+        elements.meanMotion = m_meanMotion;
+
+        // Kept for the TLE Export, only the SGP4 Model formats it during the Setup
+        Ptr<PseudoSatTLE> sat = CreateObject<PseudoSatTLE>();
+        sat->SetElements(elements);
+        m_elements.push_back(sat);
+
+        Ptr<MobilityModel> sat_mob = nullptr;
+
+        // The Propagator stays in the Table, the Node only sees the tabulated State
+        if (ephemeris != nullptr && deferred)
+        {
+            sat_mob = ephemeris->CreateMobilityModel(ephemeris->AddDeferred());
+        }
+        else if (ephemeris != nullptr)
+        {
+            sat_mob = ephemeris->CreateMobilityModel(ephemeris->Add(CreatePropagator(m_elements.size() - 1)));
+        }
+        else
+        {
+            sat_mob = CreatePropagator(m_elements.size() - 1);
+        }
 
         m_sats.push_back(sat_mob);
 
@@ -131,6 +160,36 @@ void WalkerOrbitHelper::Initialize (unsigned long satNo_seed)
 }
 
 
+Ptr<MobilityModel> WalkerOrbitHelper::CreatePropagator (unsigned int satIndex)
+{
+    NS_LOG_FUNCTION (this << satIndex);
+
+    Ptr<PseudoSatTLE> sat = m_elements.at(satIndex);
+
+    if (m_mobilityType == MOBILITY_CIRCULAR || m_mobilityType == MOBILITY_HERMITE)
+    {
+        // Closed Form from the binary Elements, no TLE Round-Trip
+        Ptr<SatCircularOrbitMobilityModel> orbit = CreateObject<SatCircularOrbitMobilityModel>();
+        orbit->SetOrbitalElements(sat->GetElements());
+
+        // Sample Interval and Span come from the SatHermiteMobilityModel Defaults
+        if (m_mobilityType == MOBILITY_HERMITE)
+        {
+            Ptr<SatHermiteMobilityModel> hermite = CreateObject<SatHermiteMobilityModel>();
+            hermite->SetReference(orbit);
+            return hermite;
+        }
+
+        return orbit;
+    }
+
+    m_satFactory.SetTypeId("ns3::SatSGP4MobilityModel");
+    Ptr<SatSGP4MobilityModel> sgp4 = m_satFactory.Create<SatSGP4MobilityModel>();
+    sgp4->SetTleInfo(sat->TleFull());
+    return sgp4;
+}
+
+
 void WalkerOrbitHelper::LogInitialPositions(const std::string filename) 
 {
 
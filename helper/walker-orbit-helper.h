@@ -17,6 +17,9 @@
 #include <ns3/object-factory.h>
 #include <ns3/object.h>
 #include <ns3/satellite-sgp4-mobility-model.h>
+#include <ns3/sat-ephemeris-table.h>
+#include <ns3/pseudo-tle.h>
+#include <ns3/sat-isl-def.h>
 
 
 namespace ns3 
@@ -26,6 +29,14 @@ namespace ns3
 class WalkerOrbitHelper : public Object
 {
     public:
+
+    typedef enum
+    {
+        MOBILITY_SGP4 = 0,
+        MOBILITY_CIRCULAR = 1,
+        MOBILITY_HERMITE = 2
+    } walkerMobilityModel_t;
+
     
     /**
      * @brief Get the Type Id object
@@ -60,7 +71,22 @@ class WalkerOrbitHelper : public Object
     {
     }
 
-    void Initialize (unsigned long satNo_seed = 0);
+    /**
+     * @brief Create the Satellites of the Orbit
+     * 
+     * @param satNo_seed    Satellite Number of the first Satellite
+     * @param ephemeris     Optional Ephemeris Table, the Nodes then read their State from the Table
+     * @param deferred      Register the Satellites without Propagator, the Table creates them through CreatePropagator
+     */
+    void Initialize (unsigned long satNo_seed = 0, Ptr<SatEphemerisTable> ephemeris = nullptr, bool deferred = false);
+
+    /**
+     * @brief Create the Propagator of a Satellite from its Elements
+     * 
+     * @param satIndex  Satellite Index (starting at 0)
+     * @return Ptr<MobilityModel> 
+     */
+    Ptr<MobilityModel> CreatePropagator(unsigned int satIndex);
 
     void LogInitialPositions (const std::string filename);
 
@@ -80,8 +106,8 @@ class WalkerOrbitHelper : public Object
 
 private:
 
-    uint8_t m_CID;        //! Constellation ID
-    uint16_t m_OID;       //! Orbit ID
+    cstid_t m_CID;        //! Constellation ID
+    orbid_t m_OID;        //! Orbit ID
 
 
     double m_inclination;
@@ -90,7 +116,10 @@ private:
     double m_raan;
     double m_meanMotion;
 
-    std::vector<Ptr<SatSGP4MobilityModel>> m_sats;
+    walkerMobilityModel_t m_mobilityType;     //! Propagator of the Satellites
+
+    std::vector<Ptr<MobilityModel>> m_sats;
+    std::vector<Ptr<PseudoSatTLE>> m_elements;  //! Elements by Satellite Index
     NodeContainer m_nodes;
     ObjectFactory m_satFactory;
 
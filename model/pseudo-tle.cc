@@ -114,6 +114,34 @@ PseudoSatTLE::PseudoSatTLE (void)
     ObjectBase::ConstructSelf (AttributeConstructionList ());
 }
 
+void PseudoSatTLE::SetElements(const SatOrbitalElements &elements)
+{
+    m_satNo = elements.satNo;
+    m_epochYear = elements.epochYear;
+    m_epochDay = elements.epochDay;
+    m_inclination = elements.inclination;
+    m_raan = elements.raan;
+    m_eccentricty = elements.eccentricity;
+    m_perigee = elements.perigee;
+    m_meanAnomaly = elements.meanAnomaly;
+    m_meanMotion = elements.meanMotion;
+}
+
+SatOrbitalElements PseudoSatTLE::GetElements(void) const
+{
+    SatOrbitalElements elements;
+    elements.satNo = m_satNo;
+    elements.epochYear = m_epochYear;
+    elements.epochDay = m_epochDay;
+    elements.inclination = m_inclination;
+    elements.raan = m_raan;
+    elements.eccentricity = m_eccentricty;
+    elements.perigee = m_perigee;
+    elements.meanAnomaly = m_meanAnomaly;
+    elements.meanMotion = m_meanMotion;
+    return elements;
+}
+
 std::string PseudoSatTLE::TleLine1(void)
 {
     std::ostringstream oss;
@@ -23,6 +23,8 @@
 #include <ns3/object.h>
 #include <ns3/object-base.h>
 
+#include "sat-orbital-elements.h"
+
 namespace ns3
 {
 
@@ -49,6 +51,23 @@ public:
     {
     }
 
+    /**
+     * @brief Set all Elements at once, without the Attribute Lookup
+     * 
+     * @param elements 
+     */
+    void SetElements (const SatOrbitalElements &elements);
+
+    /**
+     * @brief Get the Elements in full Precision
+     * 
+     * @return SatOrbitalElements 
+     */
+    SatOrbitalElements GetElements (void) const;
+
+    /**
+     * @brief Format the TLE Lines, for Export and the SGP4 Model only (Angles rounded to 4 Decimals)
+     */
     std::string TleLine1 ( void );
 
     std::string TleLine2 ( void );
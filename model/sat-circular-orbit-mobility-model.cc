@@ -0,0 +1,354 @@
+/**
+ * @brief   Analytic Mobility Model for circular Orbits
+ *
+ * @file    sat-circular-orbit-mobility-model.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-circular-orbit-mobility-model.h"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
+#include "ns3/angles.h"
+
+#include <cmath>
+#include <limits>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatCircularOrbitMobilityModel");
+    NS_OBJECT_ENSURE_REGISTERED(SatCircularOrbitMobilityModel);
+
+
+    static const double EARTH_GM = 3.986004418e14;          //! Gravitational Parameter in m^3/s^2
+    static const double EARTH_RADIUS_EQ = 6378137.0;        //! Equatorial Radius in m
+    static const double EARTH_J2 = 1.08262668e-3;           //! Second zonal Harmonic
+    static const double EARTH_ROTATION = 7.2921158553e-5;   //! Earth Rotation Rate in rad/s
+    static const double SECONDS_PER_DAY = 86400.0;
+
+
+    TypeId SatCircularOrbitMobilityModel::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatCircularOrbitMobilityModel")
+            .SetParent<MobilityModel>()
+            .AddConstructor<SatCircularOrbitMobilityModel>()
+            .AddAttribute(
+                "Inclination"
+                , "Inclination of the Orbital Plane in Degree"
+                , DoubleValue(30.0)
+                , MakeDoubleAccessor(&SatCircularOrbitMobilityModel::SetInclination, &SatCircularOrbitMobilityModel::GetInclination)
+                , MakeDoubleChecker<double>(0.0, 180.0)
+            )
+            .AddAttribute(
+                "AscendingNode"
+                , "Right Ascension of the Ascending Node at Time Zero in Degree"
+                , DoubleValue(0.0)
+                , MakeDoubleAccessor(&SatCircularOrbitMobilityModel::SetAscendingNode, &SatCircularOrbitMobilityModel::GetAscendingNode)
+                , MakeDoubleChecker<double>()
+            )
+            .AddAttribute(
+                "LatitudeArgument"
+                , "Argument of Latitude (Perigee plus Mean Anomaly) at Time Zero in Degree"
+                , DoubleValue(0.0)
+                , MakeDoubleAccessor(&SatCircularOrbitMobilityModel::SetLatitudeArgument, &SatCircularOrbitMobilityModel::GetLatitudeArgument)
+                , MakeDoubleChecker<double>()
+            )
+            .AddAttribute(
+                "MeanMotion"
+                , "Mean Motion in Revolutions per Day"
+                , DoubleValue(15.0)
+                , MakeDoubleAccessor(&SatCircularOrbitMobilityModel::SetMeanMotion, &SatCircularOrbitMobilityModel::GetMeanMotion)
+                , MakeDoubleChecker<double>(std::numeric_limits<double>::min(), 17.0)
+            )
+            .AddAttribute(
+                "J2"
+                , "Apply the secular J2 Drift of the Ascending Node and the Argument of Latitude"
+                , BooleanValue(true)
+                , MakeBooleanAccessor(&SatCircularOrbitMobilityModel::SetJ2, &SatCircularOrbitMobilityModel::GetJ2)
+                , MakeBooleanChecker()
+            )
+            .AddAttribute(
+                "EarthFixed"
+                , "Report Position and Velocity in the Earth-fixed Frame, else in the inertial Frame"
+                , BooleanValue(true)
+                , MakeBooleanAccessor(&SatCircularOrbitMobilityModel::SetEarthFixed, &SatCircularOrbitMobilityModel::GetEarthFixed)
+                , MakeBooleanChecker()
+            )
+            .AddAttribute(
+                "EarthRotationAngle"
+                , "Earth Rotation Angle (Greenwich Sidereal Time) at Time Zero in Degree, set from the Epoch by SetOrbitalElements(SatOrbitalElements)"
+                , DoubleValue(0.0)
+                , MakeDoubleAccessor(&SatCircularOrbitMobilityModel::SetEarthRotationAngle, &SatCircularOrbitMobilityModel::GetEarthRotationAngle)
+                , MakeDoubleChecker<double>()
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatCircularOrbitMobilityModel::SatCircularOrbitMobilityModel()
+    : m_inclination(DegreesToRadians(30.0))
+    , m_raan(0.0)
+    , m_latitudeArg(0.0)
+    , m_meanMotion(15.0 * 2.0 * M_PI / SECONDS_PER_DAY)
+    , m_j2(true)
+    , m_earthFixed(true)
+    , m_earthAngle(0.0)
+    , m_stamp(Time(0))
+    , m_cached(false)
+    {
+        _updateRates();
+    }
+
+
+    SatCircularOrbitMobilityModel::~SatCircularOrbitMobilityModel()
+    {
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetOrbitalElements(const double inclination, const double raan, const double latitudeArg, const double meanMotion)
+    {
+        NS_LOG_FUNCTION(this << inclination << raan << latitudeArg << meanMotion);
+
+        m_inclination = DegreesToRadians(inclination);
+        m_raan = DegreesToRadians(raan);
+        m_latitudeArg = DegreesToRadians(latitudeArg);
+        m_meanMotion = meanMotion * 2.0 * M_PI / SECONDS_PER_DAY;
+
+        _updateRates();
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetOrbitalElements(const SatOrbitalElements &elements)
+    {
+        NS_LOG_FUNCTION(this << elements.satNo);
+        if (elements.eccentricity > 0.0)
+        {
+            NS_LOG_WARN("Eccentricity " << elements.eccentricity << " is ignored by the circular Orbit");
+        }
+
+        SetOrbitalElements(elements.inclination, elements.raan, elements.perigee + elements.meanAnomaly, elements.meanMotion);
+        SetEarthRotationAngle(EarthRotationAngleAt(elements.epochYear, elements.epochDay));
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetEarthRotationAngle(const double angle)
+    {
+        m_earthAngle = angle;
+        m_cached = false;
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetEarthRotationAngle() const
+    {
+        return m_earthAngle;
+    }
+
+
+    double SatCircularOrbitMobilityModel::EarthRotationAngleAt(const int epochYear, const double epochDay)
+    {
+        // Two-digit TLE Years: 57-99 are 1957-1999, 00-56 are 2000-2056
+        int year = (epochYear < 57) ? 2000 + epochYear : 1900 + epochYear;
+
+        // Days since J2000.0 (2000-01-01 12:00 UTC)
+        double days = epochDay - 1.5;
+        for (int n = 2000; n < year; n++)
+        {
+            days += ((n % 4 == 0 && n % 100 != 0) || n % 400 == 0) ? 366.0 : 365.0;
+        }
+        for (int n = year; n < 2000; n++)
+        {
+            days -= ((n % 4 == 0 && n % 100 != 0) || n % 400 == 0) ? 366.0 : 365.0;
+        }
+
+        double angle = std::fmod(280.46061837 + 360.98564736629 * days, 360.0);
+        return (angle < 0.0) ? angle + 360.0 : angle;
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetSemiMajorAxis() const
+    {
+        return m_radius;
+    }
+
+
+    Vector SatCircularOrbitMobilityModel::DoGetPosition() const
+    {
+        _propagate();
+        return m_position;
+    }
+
+
+    void SatCircularOrbitMobilityModel::DoSetPosition(const Vector &position)
+    {
+        NS_LOG_WARN("The Position of an analytic Orbit cannot be set, set the Orbital Elements instead");
+    }
+
+
+    Vector SatCircularOrbitMobilityModel::DoGetVelocity() const
+    {
+        _propagate();
+        return m_velocity;
+    }
+
+
+    void SatCircularOrbitMobilityModel::_propagate() const
+    {
+        Time now = Simulator::Now();
+        if (m_cached && now == m_stamp) return;
+
+        GetStateAt(now, m_position, m_velocity);
+
+        m_stamp = now;
+        m_cached = true;
+    }
+
+
+    void SatCircularOrbitMobilityModel::GetStateAt(const Time time, Vector &position, Vector &velocity) const
+    {
+        double t = time.GetSeconds();
+
+        double raan = m_raan + m_raanRate * t;
+        double raan_rate = m_raanRate;
+        double u = m_latitudeArg + m_latitudeRate * t;
+
+        // In the Earth-fixed Frame the Earth Rotation acts as an additional Regression of the Node
+        if (m_earthFixed)
+        {
+            raan -= DegreesToRadians(m_earthAngle) + EARTH_ROTATION * t;
+            raan_rate -= EARTH_ROTATION;
+        }
+
+        double cos_o = std::cos(raan);
+        double sin_o = std::sin(raan);
+        double cos_u = std::cos(u);
+        double sin_u = std::sin(u);
+        double cos_i = std::cos(m_inclination);
+        double sin_i = std::sin(m_inclination);
+
+        position = Vector(
+            m_radius * (cos_o * cos_u - sin_o * sin_u * cos_i),
+            m_radius * (sin_o * cos_u + cos_o * sin_u * cos_i),
+            m_radius * (sin_u * sin_i)
+        );
+
+        // Motion along the Orbit plus Rotation of the Orbital Plane around z
+        double vu = m_radius * m_latitudeRate;
+        velocity = Vector(
+            vu * (-cos_o * sin_u - sin_o * cos_u * cos_i) - raan_rate * position.y,
+            vu * (-sin_o * sin_u + cos_o * cos_u * cos_i) + raan_rate * position.x,
+            vu * (cos_u * sin_i)
+        );
+    }
+
+
+    void SatCircularOrbitMobilityModel::_updateRates()
+    {
+        m_radius = std::cbrt(EARTH_GM / (m_meanMotion * m_meanMotion));
+
+        m_raanRate = 0.0;
+        m_latitudeRate = m_meanMotion;
+
+        if (m_j2)
+        {
+            double k = 0.75 * EARTH_J2 * std::pow(EARTH_RADIUS_EQ / m_radius, 2.0) * m_meanMotion;
+            double cos_i = std::cos(m_inclination);
+
+            m_raanRate += -2.0 * k * cos_i;
+            m_latitudeRate += k * (5.0 * cos_i * cos_i - 1.0) + k * (3.0 * cos_i * cos_i - 1.0);
+        }
+
+        m_cached = false;
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetInclination(const double inclination)
+    {
+        m_inclination = DegreesToRadians(inclination);
+        _updateRates();
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetInclination() const
+    {
+        return RadiansToDegrees(m_inclination);
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetAscendingNode(const double raan)
+    {
+        m_raan = DegreesToRadians(raan);
+        m_cached = false;
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetAscendingNode() const
+    {
+        return RadiansToDegrees(m_raan);
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetLatitudeArgument(const double latitudeArg)
+    {
+        m_latitudeArg = DegreesToRadians(latitudeArg);
+        m_cached = false;
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetLatitudeArgument() const
+    {
+        return RadiansToDegrees(m_latitudeArg);
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetMeanMotion(const double meanMotion)
+    {
+        m_meanMotion = meanMotion * 2.0 * M_PI / SECONDS_PER_DAY;
+        _updateRates();
+    }
+
+
+    double SatCircularOrbitMobilityModel::GetMeanMotion() const
+    {
+        return m_meanMotion * SECONDS_PER_DAY / (2.0 * M_PI);
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetEarthFixed(const bool enable)
+    {
+        m_earthFixed = enable;
+        m_cached = false;
+    }
+
+
+    bool SatCircularOrbitMobilityModel::GetEarthFixed() const
+    {
+        return m_earthFixed;
+    }
+
+
+    void SatCircularOrbitMobilityModel::SetJ2(const bool enable)
+    {
+        m_j2 = enable;
+        _updateRates();
+    }
+
+
+    bool SatCircularOrbitMobilityModel::GetJ2() const
+    {
+        return m_j2;
+    }
+
+
+}   /* namespace ns3 */
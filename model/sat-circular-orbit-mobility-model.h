@@ -0,0 +1,172 @@
+/**
+ * @brief   Analytic Mobility Model for circular Orbits
+ *
+ * @file    sat-circular-orbit-mobility-model.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_CIRCULAR_ORBIT_MOBILITY_MODEL_H
+#define SATELLITE_CIRCULAR_ORBIT_MOBILITY_MODEL_H
+
+
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+
+#include "sat-orbital-elements.h"
+
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * Closed-form Keplerian Propagation of a circular Orbit, built directly from the
+ * Orbital Elements of a Walker Shell. The secular J2 Drift of the Ascending Node and
+ * the Argument of Latitude can be enabled. Positions are given in the Earth-fixed
+ * Frame (like SatSGP4MobilityModel) or in the inertial Frame.
+ *
+ * Time Zero is the Epoch of the Elements: the Earth Rotation Angle is derived from it when
+ * the Orbit is set from binary Elements. SatSGP4MobilityModel starts at its own StartDate
+ * instead, both Frames only coincide if that Date equals the Element Epoch.
+ *
+ * \brief Analytic circular Orbit Mobility Model
+ */
+class SatCircularOrbitMobilityModel : public MobilityModel
+{
+public:
+
+    static TypeId GetTypeId();
+
+    SatCircularOrbitMobilityModel();
+    ~SatCircularOrbitMobilityModel();
+
+
+    /**
+     * @brief Set all Orbital Elements at once
+     *
+     * @param inclination   Inclination in Degree
+     * @param raan          Right Ascension of the Ascending Node in Degree
+     * @param latitudeArg   Argument of Latitude at Time Zero in Degree
+     * @param meanMotion    Mean Motion in Revolutions per Day
+     */
+    void SetOrbitalElements(const double inclination, const double raan, const double latitudeArg, const double meanMotion);
+
+    /**
+     * @brief Set the Orbit from binary Elements, the Eccentricity is ignored
+     *
+     * @param elements  Elements, the Argument of Latitude is Perigee plus Mean Anomaly
+     */
+    void SetOrbitalElements(const SatOrbitalElements &elements);
+
+
+    /**
+     * @brief Set the Earth Rotation Angle (Greenwich Sidereal Time) at Time Zero
+     *
+     * @param angle     Angle in Degree
+     */
+    void SetEarthRotationAngle(const double angle);
+
+    /**
+     * @brief Get the Earth Rotation Angle at Time Zero
+     *
+     * @return double   Angle in Degree
+     */
+    double GetEarthRotationAngle() const;
+
+    /**
+     * @brief Earth Rotation Angle (mean Greenwich Sidereal Time) at a TLE Epoch
+     *
+     * @param epochYear     Epoch Year (two Digits, 57-99 are 1957-1999)
+     * @param epochDay      Epoch Day of the Year incl. Fraction
+     * @return double       Angle in Degree
+     */
+    static double EarthRotationAngleAt(const int epochYear, const double epochDay);
+
+
+    /**
+     * @brief Get the Semi-Major Axis (Orbit Radius) derived from the Mean Motion
+     *
+     * @return double   Radius in m
+     */
+    double GetSemiMajorAxis() const;
+
+
+    /**
+     * @brief Evaluate the Orbit at an arbitrary Simulation Time
+     *
+     * @param time      Simulation Time
+     * @param position  Position in the configured Frame
+     * @param velocity  Velocity in the configured Frame
+     */
+    void GetStateAt(const Time time, Vector &position, Vector &velocity) const;
+
+
+private:
+
+    Vector DoGetPosition() const override;
+    void DoSetPosition(const Vector &position) override;
+    Vector DoGetVelocity() const override;
+
+
+    /**
+     * @brief Propagate Position and Velocity to the current Simulation Time, cached per Timestamp
+     */
+    void _propagate() const;
+
+    /**
+     * @brief Derive Radius and secular Rates from the Elements
+     */
+    void _updateRates();
+
+
+    void SetInclination(const double inclination);
+    double GetInclination() const;
+
+    void SetAscendingNode(const double raan);
+    double GetAscendingNode() const;
+
+    void SetLatitudeArgument(const double latitudeArg);
+    double GetLatitudeArgument() const;
+
+    void SetMeanMotion(const double meanMotion);
+    double GetMeanMotion() const;
+
+    void SetJ2(const bool enable);
+    bool GetJ2() const;
+
+    void SetEarthFixed(const bool enable);
+    bool GetEarthFixed() const;
+
+
+    double m_inclination;           //!< Inclination in rad
+    double m_raan;                  //!< Ascending Node at Time Zero in rad
+    double m_latitudeArg;           //!< Argument of Latitude at Time Zero in rad
+    double m_meanMotion;            //!< Mean Motion in rad/s
+
+    bool m_j2;                      //!< Apply secular J2 Drift
+    bool m_earthFixed;              //!< Output in the Earth-fixed Frame
+    double m_earthAngle;            //!< Earth Rotation Angle at Time Zero in Degree
+
+    double m_radius;                //!< Orbit Radius in m
+    double m_raanRate;              //!< Inertial Rate of the Ascending Node in rad/s
+    double m_latitudeRate;          //!< Rate of the Argument of Latitude in rad/s
+
+    mutable Time m_stamp;           //!< Simulation Time of the cached State
+    mutable bool m_cached;          //!< Cached State is valid
+    mutable Vector m_position;      //!< Cached Position
+    mutable Vector m_velocity;      //!< Cached Velocity
+
+};  /* SatCircularOrbitMobilityModel */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_CIRCULAR_ORBIT_MOBILITY_MODEL_H */
@@ -0,0 +1,238 @@
+/**
+ * @brief   Memory-mapped on-disk Ephemeris Cache
+ *
+ * @file    sat-ephemeris-cache.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-ephemeris-cache.h"
+
+#include "ns3/log.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatEphemerisCache");
+
+
+    static const char EPHEMERIS_MAGIC[8] = {'S', 'A', 'T', 'E', 'P', 'H', '0', '1'};
+
+
+    SatEphemerisCache::SatEphemerisCache()
+    : m_base(nullptr)
+    , m_size(0)
+    , m_data(nullptr)
+    , m_N(0)
+    , m_samples(0)
+    {
+    }
+
+
+    SatEphemerisCache::~SatEphemerisCache()
+    {
+        Close();
+    }
+
+
+    bool SatEphemerisCache::Open(const std::string &path, const uint64_t key, const uint32_t N, const Time step, const uint64_t samples)
+    {
+        NS_LOG_FUNCTION(this << path << key << N << step << samples);
+        Close();
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        size_t size = _size(N, samples);
+
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size != size || !_map(fd, size, false))
+        {
+            close(fd);
+            return false;
+        }
+        close(fd);
+
+        const Header *hdr = static_cast<const Header*>(m_base);
+        if (std::memcmp(hdr->magic, EPHEMERIS_MAGIC, sizeof(EPHEMERIS_MAGIC)) != 0
+            || hdr->key != key || hdr->N != N || hdr->samples != samples || hdr->step != step.GetNanoSeconds())
+        {
+            NS_LOG_WARN("Ephemeris Cache " << path << " does not match the Constellation");
+            Close();
+            return false;
+        }
+
+        m_path = path;
+        m_N = N;
+        m_samples = samples;
+        return true;
+    }
+
+
+    bool SatEphemerisCache::Create(const std::string &path, const uint64_t key, const uint32_t N, const Time step, const uint64_t samples)
+    {
+        NS_LOG_FUNCTION(this << path << key << N << step << samples);
+        Close();
+
+        std::string tmp = path + ".tmp";
+        size_t size = _size(N, samples);
+
+        int fd = open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+        {
+            NS_LOG_WARN("Cannot create Ephemeris Cache " << tmp);
+            return false;
+        }
+
+        if (ftruncate(fd, size) != 0 || !_map(fd, size, true))
+        {
+            close(fd);
+            unlink(tmp.c_str());
+            return false;
+        }
+        close(fd);
+
+        Header *hdr = static_cast<Header*>(m_base);
+        std::memset(hdr, 0, sizeof(Header));
+        std::memcpy(hdr->magic, EPHEMERIS_MAGIC, sizeof(EPHEMERIS_MAGIC));
+        hdr->key = key;
+        hdr->samples = samples;
+        hdr->step = step.GetNanoSeconds();
+        hdr->N = N;
+
+        m_path = path;
+        m_tmpPath = tmp;
+        m_N = N;
+        m_samples = samples;
+        return true;
+    }
+
+
+    bool SatEphemerisCache::Commit()
+    {
+        NS_LOG_FUNCTION(this << m_path);
+        if (!IsWritable()) return false;
+
+        bool ok = msync(m_base, m_size, MS_SYNC) == 0;
+        munmap(m_base, m_size);
+        m_base = nullptr;
+
+        ok = ok && std::rename(m_tmpPath.c_str(), m_path.c_str()) == 0;
+        if (!ok)
+        {
+            NS_LOG_WARN("Cannot commit Ephemeris Cache " << m_path);
+            unlink(m_tmpPath.c_str());
+        }
+
+        m_tmpPath.clear();
+        Close();
+        return ok;
+    }
+
+
+    void SatEphemerisCache::Close()
+    {
+        if (m_base != nullptr)
+        {
+            munmap(m_base, m_size);
+        }
+
+        if (!m_tmpPath.empty())
+        {
+            unlink(m_tmpPath.c_str());
+        }
+
+        m_base = nullptr;
+        m_size = 0;
+        m_data = nullptr;
+        m_N = 0;
+        m_samples = 0;
+        m_path.clear();
+        m_tmpPath.clear();
+    }
+
+
+    const double* SatEphemerisCache::GetSample(const uint64_t k) const
+    {
+        NS_ASSERT(k < m_samples);
+        return m_data + k * 6 * m_N;
+    }
+
+
+    double* SatEphemerisCache::GetWritableSample(const uint64_t k)
+    {
+        NS_ASSERT(IsWritable() && k < m_samples);
+        return m_data + k * 6 * m_N;
+    }
+
+
+    bool SatEphemerisCache::IsOpen() const
+    {
+        return m_base != nullptr;
+    }
+
+
+    bool SatEphemerisCache::IsWritable() const
+    {
+        return m_base != nullptr && !m_tmpPath.empty();
+    }
+
+
+    uint32_t SatEphemerisCache::GetN() const
+    {
+        return m_N;
+    }
+
+
+    uint64_t SatEphemerisCache::GetSamples() const
+    {
+        return m_samples;
+    }
+
+
+    uint64_t SatEphemerisCache::Hash(const std::string &params)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : params)
+        {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+
+    size_t SatEphemerisCache::_size(const uint32_t N, const uint64_t samples)
+    {
+        return sizeof(Header) + samples * 6 * N * sizeof(double);
+    }
+
+
+    bool SatEphemerisCache::_map(const int fd, const size_t size, const bool writable)
+    {
+        int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void *base = mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) return false;
+
+        m_base = base;
+        m_size = size;
+        m_data = reinterpret_cast<double*>(static_cast<char*>(base) + sizeof(Header));
+        return true;
+    }
+
+
+}   /* namespace ns3 */
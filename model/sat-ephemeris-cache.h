@@ -0,0 +1,150 @@
+/**
+ * @brief   Memory-mapped on-disk Ephemeris Cache
+ *
+ * @file    sat-ephemeris-cache.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_EPHEMERIS_CACHE_H
+#define SATELLITE_EPHEMERIS_CACHE_H
+
+
+#include "ns3/nstime.h"
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * Binary File of sampled Satellite States on a fixed Time Grid. Each Sample is stored as
+ * x[N], y[N], z[N], vx[N], vy[N], vz[N] (like the Arrays of SatEphemerisTable), so a Sample
+ * is one contiguous Block and can be copied without parsing.
+ *
+ * A File is written to "<path>.tmp" and only renamed to its final Path once all Samples
+ * are recorded, so an aborted Run never leaves a truncated Cache behind.
+ *
+ * \brief Memory-mapped Ephemeris File
+ */
+class SatEphemerisCache
+{
+public:
+
+    SatEphemerisCache();
+    ~SatEphemerisCache();
+
+    SatEphemerisCache(const SatEphemerisCache&) = delete;
+    SatEphemerisCache& operator=(const SatEphemerisCache&) = delete;
+
+
+    /**
+     * @brief Map an existing Cache File read-only
+     *
+     * @param path      Path of the File
+     * @param key       Expected Parameter Hash
+     * @param N         Expected Number of Satellites
+     * @param step      Expected Sampling Step
+     * @param samples   Expected Number of Samples
+     * @return true     File matches and is mapped
+     */
+    bool Open(const std::string &path, const uint64_t key, const uint32_t N, const Time step, const uint64_t samples);
+
+    /**
+     * @brief Create a new Cache File and map it writable
+     *
+     * @return true     File was created
+     */
+    bool Create(const std::string &path, const uint64_t key, const uint32_t N, const Time step, const uint64_t samples);
+
+    /**
+     * @brief Flush the recorded File and move it to its final Path
+     *
+     * @return true     File was committed
+     */
+    bool Commit();
+
+    /**
+     * @brief Unmap the File, an uncommitted File is removed
+     */
+    void Close();
+
+
+    /**
+     * @brief Get the State Block of a Sample (x, y, z, vx, vy, vz Arrays of N Values each)
+     *
+     * @param k     Sample Index
+     * @return const double*
+     */
+    const double* GetSample(const uint64_t k) const;
+
+    /**
+     * @brief Get the writable State Block of a Sample
+     */
+    double* GetWritableSample(const uint64_t k);
+
+
+    bool IsOpen() const;
+    bool IsWritable() const;
+
+    uint32_t GetN() const;
+    uint64_t GetSamples() const;
+
+
+    /**
+     * @brief FNV-1a Hash of a Parameter String, used as Key of a Cache File
+     *
+     * @param params    Canonical Parameter String
+     * @return uint64_t
+     */
+    static uint64_t Hash(const std::string &params);
+
+
+private:
+
+    /**
+     * @brief File Header, followed by the Sample Blocks
+     */
+    struct Header
+    {
+        char magic[8];          //!< File Magic "SATEPH01"
+        uint64_t key;           //!< Parameter Hash
+        uint64_t samples;       //!< Number of Samples
+        int64_t step;           //!< Sampling Step in Nanoseconds
+        uint32_t N;             //!< Number of Satellites
+        uint32_t reserved[7];   //!< Pad the Header to 64 Bytes
+    };
+
+
+    static size_t _size(const uint32_t N, const uint64_t samples);
+
+    bool _map(const int fd, const size_t size, const bool writable);
+
+
+    std::string m_path;         //!< Final Path of the File
+    std::string m_tmpPath;      //!< Path while recording, empty if read-only
+
+    void *m_base;               //!< Mapped File
+    size_t m_size;              //!< Size of the Mapping in Bytes
+    double *m_data;             //!< First Sample Block
+
+    uint32_t m_N;               //!< Number of Satellites
+    uint64_t m_samples;         //!< Number of Samples
+
+};  /* SatEphemerisCache */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_EPHEMERIS_CACHE_H */
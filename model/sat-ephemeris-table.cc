@@ -0,0 +1,552 @@
+/**
+ * @brief   Batch Ephemeris Table and thin Mobility Model
+ *
+ * @file    sat-ephemeris-table.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-ephemeris-table.h"
+#include "sat-circular-orbit-mobility-model.h"
+#include "sat-hermite-mobility-model.h"
+#include "sat-worker-pool.h"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatEphemerisTable");
+    NS_OBJECT_ENSURE_REGISTERED(SatEphemerisTable);
+    NS_OBJECT_ENSURE_REGISTERED(SatEphemerisMobilityModel);
+
+
+    static const size_t EPHEMERIS_MIN_CHUNK = 64;       //! Min. Satellites per Thread and Pass
+
+
+
+//  BEGIN: SatEphemerisTable +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+
+    TypeId SatEphemerisTable::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatEphemerisTable")
+            .SetParent<Object>()
+            .AddConstructor<SatEphemerisTable>()
+            .AddAttribute(
+                "Step"
+                , "Time between two Propagation Passes over all Satellites"
+                , TimeValue(Seconds(1))
+                , MakeTimeAccessor(&SatEphemerisTable::SetStep, &SatEphemerisTable::GetStep)
+                , MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "Threads"
+                , "Number of Threads for a Propagation Pass, zero uses all Cores (circular and Hermite Propagators only)"
+                , UintegerValue(1)
+                , MakeUintegerAccessor(&SatEphemerisTable::SetThreads, &SatEphemerisTable::GetThreads)
+                , MakeUintegerChecker<uint32_t>()
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatEphemerisTable::SatEphemerisTable()
+    : m_deferred(0)
+    , m_step(Seconds(1))
+    , m_stamp(Time(0))
+    , m_valid(false)
+    , m_threads(1)
+    , m_replay(false)
+    , m_sample(0)
+    {
+    }
+
+
+    SatEphemerisTable::~SatEphemerisTable()
+    {
+    }
+
+
+    void SatEphemerisTable::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        Simulator::Cancel(m_recordEvent);
+        m_cache.reset();
+        m_pool.reset();
+        m_sources.clear();
+        m_kind.clear();
+        m_parallel.clear();
+        m_serial.clear();
+        m_factory.Nullify();
+
+        Object::DoDispose();
+    }
+
+
+    uint32_t SatEphemerisTable::Add(Ptr<MobilityModel> source)
+    {
+        NS_LOG_FUNCTION(this << source);
+        NS_ASSERT_MSG(m_cache == nullptr, "Satellites must be added before the Cache is set");
+
+        uint32_t id = m_sources.size();
+        m_sources.push_back(source);
+        m_kind.push_back(SOURCE_OTHER);
+        _classify(id);
+
+        for (auto *arr : {&m_x, &m_y, &m_z, &m_vx, &m_vy, &m_vz, &m_ax, &m_ay, &m_az})
+        {
+            arr->push_back(0.0);
+        }
+
+        m_valid = false;
+        return id;
+    }
+
+
+    uint32_t SatEphemerisTable::AddDeferred()
+    {
+        NS_LOG_FUNCTION(this);
+        NS_ASSERT_MSG(m_cache == nullptr, "Satellites must be added before the Cache is set");
+
+        uint32_t id = m_sources.size();
+        m_sources.push_back(nullptr);
+        m_kind.push_back(SOURCE_OTHER);
+        m_deferred++;
+
+        for (auto *arr : {&m_x, &m_y, &m_z, &m_vx, &m_vy, &m_vz, &m_ax, &m_ay, &m_az})
+        {
+            arr->push_back(0.0);
+        }
+
+        m_valid = false;
+        return id;
+    }
+
+
+    void SatEphemerisTable::SetSourceFactory(Callback<Ptr<MobilityModel>, uint32_t> factory)
+    {
+        m_factory = factory;
+    }
+
+
+    Ptr<MobilityModel> SatEphemerisTable::CreateMobilityModel(const uint32_t id)
+    {
+        NS_ASSERT_MSG(id < m_sources.size(), "Satellite " << id << " is not registered in the Ephemeris Table");
+
+        Ptr<SatEphemerisMobilityModel> mob = CreateObject<SatEphemerisMobilityModel>();
+        mob->SetTable(this, id);
+        return mob;
+    }
+
+
+    size_t SatEphemerisTable::GetN() const
+    {
+        return m_sources.size();
+    }
+
+
+    void SatEphemerisTable::Update()
+    {
+        NS_LOG_FUNCTION(this << m_sources.size());
+
+        Time now = Simulator::Now();
+        double dt = (now - m_stamp).GetSeconds();
+        bool diff = m_valid && dt > 0.0;
+
+        // Keep the last Velocity to difference the Acceleration
+        if (diff)
+        {
+            m_ax.swap(m_vx);
+            m_ay.swap(m_vy);
+            m_az.swap(m_vz);
+        }
+
+        if (m_deferred > 0) _createDeferred();
+
+        _sampleSerial();
+
+        if (!m_parallel.empty())
+        {
+            if (m_pool == nullptr)
+            {
+                size_t threads = (m_threads > 0) ? m_threads : std::max(1u, std::thread::hardware_concurrency());
+                m_pool.reset(new SatWorkerPool(threads - 1));
+            }
+
+            const size_t N = m_parallel.size();
+            const size_t chunks = std::min(m_pool->GetNTasks(), std::max<size_t>(1, N / EPHEMERIS_MIN_CHUNK));
+
+            m_pool->Run(chunks, [this, now, N, chunks](size_t idx) { _sample((N * idx) / chunks, (N * (idx + 1)) / chunks, now); });
+        }
+
+        size_t N = m_sources.size();
+        for (size_t n = 0; n < N; n++)
+        {
+            m_ax[n] = diff ? (m_vx[n] - m_ax[n]) / dt : 0.0;
+            m_ay[n] = diff ? (m_vy[n] - m_ay[n]) / dt : 0.0;
+            m_az[n] = diff ? (m_vz[n] - m_az[n]) / dt : 0.0;
+        }
+
+        m_stamp = now;
+        m_valid = true;
+        m_sample = UINT64_MAX;
+    }
+
+
+    void SatEphemerisTable::SetCache(const std::string &path, const uint64_t key, const Time span)
+    {
+        NS_LOG_FUNCTION(this << path << key << span);
+        NS_ASSERT_MSG(m_step.IsStrictlyPositive(), "The Ephemeris Cache needs a positive Step");
+
+        Simulator::Cancel(m_recordEvent);
+        m_replay = false;
+
+        uint32_t N = m_sources.size();
+        uint64_t samples = span.GetTimeStep() / m_step.GetTimeStep() + 1;
+
+        m_cache.reset(new SatEphemerisCache());
+
+        if (m_cache->Open(path, key, N, m_step, samples))
+        {
+            NS_LOG_INFO("Replaying " << samples << " Ephemeris Samples from " << path);
+            m_replay = true;
+            m_valid = false;
+            return;
+        }
+
+        // The File has to start at Time Zero, a late Table keeps propagating without Cache
+        if (!Simulator::Now().IsZero() || !m_cache->Create(path, key, N, m_step, samples))
+        {
+            m_cache.reset();
+            return;
+        }
+
+        NS_LOG_INFO("Recording " << samples << " Ephemeris Samples to " << path);
+        m_recordEvent = Simulator::ScheduleNow(&SatEphemerisTable::_record, this, 0);
+    }
+
+
+    bool SatEphemerisTable::IsReplaying() const
+    {
+        return m_replay;
+    }
+
+
+    Vector SatEphemerisTable::GetPosition(const uint32_t id)
+    {
+        _ensureCurrent();
+
+        double t = (Simulator::Now() - m_stamp).GetSeconds();
+        double h = 0.5 * t * t;
+
+        return Vector(
+            m_x[id] + m_vx[id] * t + m_ax[id] * h,
+            m_y[id] + m_vy[id] * t + m_ay[id] * h,
+            m_z[id] + m_vz[id] * t + m_az[id] * h
+        );
+    }
+
+
+    Vector SatEphemerisTable::GetVelocity(const uint32_t id)
+    {
+        _ensureCurrent();
+
+        double t = (Simulator::Now() - m_stamp).GetSeconds();
+
+        return Vector(
+            m_vx[id] + m_ax[id] * t,
+            m_vy[id] + m_ay[id] * t,
+            m_vz[id] + m_az[id] * t
+        );
+    }
+
+
+    void SatEphemerisTable::SetStep(const Time step)
+    {
+        m_step = step;
+    }
+
+
+    Time SatEphemerisTable::GetStep() const
+    {
+        return m_step;
+    }
+
+
+    void SatEphemerisTable::SetThreads(const uint32_t threads)
+    {
+        m_threads = threads;
+        m_pool.reset();
+    }
+
+
+    uint32_t SatEphemerisTable::GetThreads() const
+    {
+        return m_threads;
+    }
+
+
+    void SatEphemerisTable::_ensureCurrent()
+    {
+        Time now = Simulator::Now();
+
+        if (m_replay)
+        {
+            uint64_t k = now.GetTimeStep() / m_step.GetTimeStep();
+            if (k < m_cache->GetSamples())
+            {
+                if (!m_valid || m_sample != k) _load(k);
+                return;
+            }
+        }
+
+        if (m_valid && (now == m_stamp || (now > m_stamp && (now - m_stamp) < m_step))) return;
+
+        Update();
+    }
+
+
+    void SatEphemerisTable::_sample(const size_t begin, const size_t end, const Time time)
+    {
+        // Evaluated at the explicit Time, no Simulator Access and no cached State is touched
+        Vector pos, vel;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            uint32_t n = m_parallel[i];
+            MobilityModel *source = PeekPointer(m_sources[n]);
+
+            if (m_kind[n] == SOURCE_CIRCULAR)
+            {
+                static_cast<SatCircularOrbitMobilityModel *>(source)->GetStateAt(time, pos, vel);
+            }
+            else
+            {
+                static_cast<SatHermiteMobilityModel *>(source)->GetStateAt(time, pos, vel);
+            }
+
+            m_x[n] = pos.x;
+            m_y[n] = pos.y;
+            m_z[n] = pos.z;
+            m_vx[n] = vel.x;
+            m_vy[n] = vel.y;
+            m_vz[n] = vel.z;
+        }
+    }
+
+
+    void SatEphemerisTable::_classify(const uint32_t id)
+    {
+        const Ptr<MobilityModel> &source = m_sources[id];
+
+        // Only Propagators of this Module are known to be const-safe off the Simulator Thread
+        if (DynamicCast<SatCircularOrbitMobilityModel>(source) != nullptr)
+        {
+            m_kind[id] = SOURCE_CIRCULAR;
+            m_parallel.push_back(id);
+        }
+        else if (DynamicCast<SatHermiteMobilityModel>(source) != nullptr)
+        {
+            m_kind[id] = SOURCE_HERMITE;
+            m_parallel.push_back(id);
+        }
+        else
+        {
+            m_kind[id] = SOURCE_OTHER;
+            m_serial.push_back(id);
+        }
+    }
+
+
+    void SatEphemerisTable::_createDeferred()
+    {
+        NS_LOG_FUNCTION(this << m_deferred);
+        NS_ASSERT_MSG(!m_factory.IsNull(), "Deferred Satellites need a Source Factory");
+
+        size_t N = m_sources.size();
+        for (uint32_t n = 0; n < N; n++)
+        {
+            if (m_sources[n] != nullptr) continue;
+
+            m_sources[n] = m_factory(n);
+            NS_ASSERT_MSG(m_sources[n] != nullptr, "Source Factory returned no Propagator for Satellite " << n);
+            _classify(n);
+        }
+
+        // The Factory may hold its Helper, drop it once all Sources exist
+        m_deferred = 0;
+        m_factory.Nullify();
+    }
+
+
+    void SatEphemerisTable::_sampleSerial()
+    {
+        for (const uint32_t n : m_serial)
+        {
+            MobilityModel *source = PeekPointer(m_sources[n]);
+
+            Vector pos = source->GetPosition();
+            Vector vel = source->GetVelocity();
+
+            m_x[n] = pos.x;
+            m_y[n] = pos.y;
+            m_z[n] = pos.z;
+            m_vx[n] = vel.x;
+            m_vy[n] = vel.y;
+            m_vz[n] = vel.z;
+        }
+    }
+
+
+
+    void SatEphemerisTable::_load(const uint64_t k)
+    {
+        size_t N = m_sources.size();
+        const double *s = m_cache->GetSample(k);
+
+        std::copy(s + 0 * N, s + 1 * N, m_x.begin());
+        std::copy(s + 1 * N, s + 2 * N, m_y.begin());
+        std::copy(s + 2 * N, s + 3 * N, m_z.begin());
+        std::copy(s + 3 * N, s + 4 * N, m_vx.begin());
+        std::copy(s + 4 * N, s + 5 * N, m_vy.begin());
+        std::copy(s + 5 * N, s + 6 * N, m_vz.begin());
+
+        // The next Sample is already known, so the Acceleration is a forward Difference,
+        // the last Sample keeps the Acceleration of its Predecessor
+        if (k + 1 < m_cache->GetSamples())
+        {
+            const double *next = m_cache->GetSample(k + 1);
+            double dt = m_step.GetSeconds();
+
+            for (size_t n = 0; n < N; n++)
+            {
+                m_ax[n] = (next[3 * N + n] - m_vx[n]) / dt;
+                m_ay[n] = (next[4 * N + n] - m_vy[n]) / dt;
+                m_az[n] = (next[5 * N + n] - m_vz[n]) / dt;
+            }
+        }
+
+        m_stamp = TimeStep(k * m_step.GetTimeStep());
+        m_sample = k;
+        m_valid = true;
+    }
+
+
+    void SatEphemerisTable::_record(const uint64_t k)
+    {
+        NS_LOG_FUNCTION(this << k);
+
+        if (!(m_valid && m_stamp == Simulator::Now())) Update();
+
+        size_t N = m_sources.size();
+        double *s = m_cache->GetWritableSample(k);
+
+        std::copy(m_x.begin(), m_x.end(), s + 0 * N);
+        std::copy(m_y.begin(), m_y.end(), s + 1 * N);
+        std::copy(m_z.begin(), m_z.end(), s + 2 * N);
+        std::copy(m_vx.begin(), m_vx.end(), s + 3 * N);
+        std::copy(m_vy.begin(), m_vy.end(), s + 4 * N);
+        std::copy(m_vz.begin(), m_vz.end(), s + 5 * N);
+
+        if (k + 1 < m_cache->GetSamples())
+        {
+            m_recordEvent = Simulator::Schedule(m_step, &SatEphemerisTable::_record, this, k + 1);
+            return;
+        }
+
+        if (m_cache->Commit())
+        {
+            NS_LOG_INFO("Ephemeris Cache recorded with " << k + 1 << " Samples");
+        }
+        m_cache.reset();
+    }
+
+
+
+//  BEGIN: SatEphemerisMobilityModel +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+
+    TypeId SatEphemerisMobilityModel::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatEphemerisMobilityModel")
+            .SetParent<MobilityModel>()
+            .AddConstructor<SatEphemerisMobilityModel>()
+        ;
+
+        return tid;
+    }
+
+
+    SatEphemerisMobilityModel::SatEphemerisMobilityModel()
+    : m_table(nullptr)
+    , m_id(0)
+    {
+    }
+
+
+    SatEphemerisMobilityModel::~SatEphemerisMobilityModel()
+    {
+    }
+
+
+    void SatEphemerisMobilityModel::DoDispose()
+    {
+        m_table = nullptr;
+        MobilityModel::DoDispose();
+    }
+
+
+    void SatEphemerisMobilityModel::SetTable(Ptr<SatEphemerisTable> table, const uint32_t id)
+    {
+        NS_LOG_FUNCTION(this << table << id);
+        m_table = table;
+        m_id = id;
+    }
+
+
+    Ptr<SatEphemerisTable> SatEphemerisMobilityModel::GetTable() const
+    {
+        return m_table;
+    }
+
+
+    uint32_t SatEphemerisMobilityModel::GetIndex() const
+    {
+        return m_id;
+    }
+
+
+    Vector SatEphemerisMobilityModel::DoGetPosition() const
+    {
+        return m_table->GetPosition(m_id);
+    }
+
+
+    void SatEphemerisMobilityModel::DoSetPosition(const Vector &position)
+    {
+        NS_LOG_WARN("The Position of a tabulated Satellite cannot be set");
+    }
+
+
+    Vector SatEphemerisMobilityModel::DoGetVelocity() const
+    {
+        return m_table->GetVelocity(m_id);
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,266 @@
+/**
+ * @brief   Batch Ephemeris Table and thin Mobility Model
+ *
+ * @file    sat-ephemeris-table.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_EPHEMERIS_TABLE_H
+#define SATELLITE_EPHEMERIS_TABLE_H
+
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/mobility-model.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+
+#include "sat-ephemeris-cache.h"
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+class SatWorkerPool;
+
+
+/**
+ * \ingroup satellite
+ *
+ * The Table propagates all registered Source Mobility Models (e.g. SGP4) in one Pass per
+ * Time Step and stores the States in contiguous x/y/z/vx/vy/vz Arrays. Only the Propagators
+ * of this Module that are evaluated in closed Form at an explicit Time (circular Orbit and
+ * Hermite Samples) are split across a Pool of Worker Threads, all other Models (e.g. SGP4)
+ * are sampled on the Simulator Thread. Between two Passes the States are advanced with a second
+ * Order Expansion, the Acceleration is taken from the Velocity Difference of the last two Passes.
+ *
+ * A Pass is triggered by the first Query after the Step expired. Only while a Cache File
+ * is recorded the Table schedules its own Passes, one per Step until the Span is covered.
+ * A complete Cache File replaces the Propagation within its Span. Satellites registered with
+ * AddDeferred get their Propagator from the Source Factory on the first Pass, so a replayed
+ * Span never builds them.
+ *
+ * \brief Structure-of-Arrays Ephemeris Cache
+ */
+class SatEphemerisTable : public Object
+{
+public:
+
+    static TypeId GetTypeId();
+
+    SatEphemerisTable();
+    ~SatEphemerisTable();
+
+
+    /**
+     * @brief Register a Source Mobility Model
+     *
+     * @param source    Propagator of the Satellite, must not be aggregated to the Node
+     * @return uint32_t Index of the Satellite in the Table
+     */
+    uint32_t Add(Ptr<MobilityModel> source);
+
+    /**
+     * @brief Register a Satellite whose Propagator is created by the Source Factory on the first Pass
+     *
+     * @return uint32_t Index of the Satellite in the Table
+     */
+    uint32_t AddDeferred();
+
+    /**
+     * @brief Set the Factory of the deferred Propagators
+     *
+     * @param factory   Creates the Propagator of a Satellite Index
+     */
+    void SetSourceFactory(Callback<Ptr<MobilityModel>, uint32_t> factory);
+
+
+    /**
+     * @brief Create a thin Mobility Model reading from the Table
+     *
+     * @param id    Index of the Satellite
+     * @return Ptr<MobilityModel>
+     */
+    Ptr<MobilityModel> CreateMobilityModel(const uint32_t id);
+
+
+    /**
+     * @brief Propagate all Sources at the current Simulation Time
+     */
+    void Update();
+
+
+    /**
+     * @brief Attach an on-disk Cache, must be called after all Satellites were added
+     *
+     *        A matching File is mapped and replayed, otherwise the States of the first
+     *        Span of the Simulation are recorded into a new File.
+     *
+     * @param path  Path of the Cache File
+     * @param key   Hash of the Parameters the States depend on
+     * @param span  Simulation Time covered by the File
+     */
+    void SetCache(const std::string &path, const uint64_t key, const Time span);
+
+    /**
+     * @brief Check if the States are read from a Cache File
+     *
+     * @return true
+     */
+    bool IsReplaying() const;
+
+
+    Vector GetPosition(const uint32_t id);
+
+    Vector GetVelocity(const uint32_t id);
+
+
+    /**
+     * @brief Get the Number of registered Satellites
+     *
+     * @return size_t
+     */
+    size_t GetN() const;
+
+
+    void SetStep(const Time step);
+    Time GetStep() const;
+
+    void SetThreads(const uint32_t threads);
+    uint32_t GetThreads() const;
+
+
+protected:
+
+    void DoDispose() override;
+
+
+private:
+
+    /**
+     * @brief Run a Pass if the Step expired
+     */
+    void _ensureCurrent();
+
+    /**
+     * @brief Sample the thread-safe Sources m_parallel[begin, end) at a Time into the Arrays
+     */
+    void _sample(const size_t begin, const size_t end, const Time time);
+
+    /**
+     * @brief Sample all other Sources through the MobilityModel Interface
+     */
+    void _sampleSerial();
+
+    /**
+     * @brief Sort a Source into the parallel or the serial Set
+     */
+    void _classify(const uint32_t id);
+
+    /**
+     * @brief Create all deferred Sources through the Source Factory
+     */
+    void _createDeferred();
+
+    /**
+     * @brief Copy the cached Sample k into the Arrays
+     */
+    void _load(const uint64_t k);
+
+    /**
+     * @brief Store the current Pass as Sample k and schedule the next one
+     */
+    void _record(const uint64_t k);
+
+
+    /**
+     * @brief Propagators that are safe to evaluate off the Simulator Thread
+     */
+    enum SourceKind : uint8_t
+    {
+        SOURCE_OTHER = 0,
+        SOURCE_CIRCULAR,
+        SOURCE_HERMITE
+    };
+
+    std::vector<Ptr<MobilityModel>> m_sources;      //!< Propagator by Satellite Index
+    std::vector<uint8_t> m_kind;                    //!< SourceKind by Satellite Index
+    std::vector<uint32_t> m_parallel;               //!< Satellites sampled by the Worker Threads
+    std::vector<uint32_t> m_serial;                 //!< Satellites sampled on the Simulator Thread
+    size_t m_deferred;                              //!< Satellites without Source yet
+    Callback<Ptr<MobilityModel>, uint32_t> m_factory;   //!< Creates the deferred Sources
+
+    std::vector<double> m_x, m_y, m_z;              //!< Position at m_stamp
+    std::vector<double> m_vx, m_vy, m_vz;           //!< Velocity at m_stamp
+    std::vector<double> m_ax, m_ay, m_az;           //!< Acceleration from the last two Passes
+
+    Time m_step;                                    //!< Time between two Passes
+    Time m_stamp;                                   //!< Time of the last Pass
+    bool m_valid;                                   //!< At least one Pass was done
+
+    uint32_t m_threads;                             //!< Number of Threads, zero for all Cores
+    std::unique_ptr<SatWorkerPool> m_pool;          //!< Worker Threads, created on the first Pass
+
+    std::unique_ptr<SatEphemerisCache> m_cache;     //!< Cache File, recording or replaying
+    bool m_replay;                                  //!< States are read from m_cache
+    uint64_t m_sample;                              //!< Sample loaded into the Arrays
+    EventId m_recordEvent;                          //!< Next recorded Pass
+
+};  /* SatEphemerisTable */
+
+
+
+/**
+ * \ingroup satellite
+ *
+ * \brief Mobility Model reading the State of one Satellite from a SatEphemerisTable
+ */
+class SatEphemerisMobilityModel : public MobilityModel
+{
+public:
+
+    static TypeId GetTypeId();
+
+    SatEphemerisMobilityModel();
+    ~SatEphemerisMobilityModel();
+
+
+    void SetTable(Ptr<SatEphemerisTable> table, const uint32_t id);
+
+    Ptr<SatEphemerisTable> GetTable() const;
+
+    uint32_t GetIndex() const;
+
+
+protected:
+
+    void DoDispose() override;
+
+
+private:
+
+    Vector DoGetPosition() const override;
+    void DoSetPosition(const Vector &position) override;
+    Vector DoGetVelocity() const override;
+
+
+    Ptr<SatEphemerisTable> m_table;     //!< Shared Ephemeris Table
+    uint32_t m_id;                      //!< Index of the Satellite in the Table
+
+};  /* SatEphemerisMobilityModel */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_EPHEMERIS_TABLE_H */
@@ -0,0 +1,256 @@
+/**
+ * @brief   Mobility Model interpolating sampled Ephemerides
+ *
+ * @file    sat-hermite-mobility-model.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-hermite-mobility-model.h"
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatHermiteMobilityModel");
+    NS_OBJECT_ENSURE_REGISTERED(SatHermiteMobilityModel);
+
+
+    static const double HERMITE_MIN_INTERVAL = 1e-3;        //! Refinement stops at 1 ms
+
+
+    TypeId SatHermiteMobilityModel::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatHermiteMobilityModel")
+            .SetParent<MobilityModel>()
+            .AddConstructor<SatHermiteMobilityModel>()
+            .AddAttribute(
+                "SampleInterval"
+                , "Time between two Samples, sets the Memory Footprint per Satellite"
+                , TimeValue(Seconds(10))
+                , MakeTimeAccessor(&SatHermiteMobilityModel::m_interval)
+                , MakeTimeChecker(MilliSeconds(1))
+            )
+            .AddAttribute(
+                "Span"
+                , "Simulation Time covered by the Samples of a Reference Orbit"
+                , TimeValue(Seconds(3600))
+                , MakeTimeAccessor(&SatHermiteMobilityModel::m_span)
+                , MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "Tolerance"
+                , "Max. Position Error against the Reference in m, the Interval is halved until it holds (zero disables)"
+                , DoubleValue(1.0)
+                , MakeDoubleAccessor(&SatHermiteMobilityModel::m_tolerance)
+                , MakeDoubleChecker<double>(0.0)
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatHermiteMobilityModel::SatHermiteMobilityModel()
+    : m_reference(nullptr)
+    , m_interval(Seconds(10))
+    , m_span(Seconds(3600))
+    , m_tolerance(1.0)
+    , m_start(Time(0))
+    , m_step(Seconds(10))
+    , m_maxError(0.0)
+    {
+    }
+
+
+    SatHermiteMobilityModel::~SatHermiteMobilityModel()
+    {
+    }
+
+
+    void SatHermiteMobilityModel::SetReference(Ptr<SatCircularOrbitMobilityModel> reference)
+    {
+        NS_LOG_FUNCTION(this << reference);
+
+        m_reference = reference;
+        m_start = Simulator::Now();
+        m_step = m_interval;
+
+        while ((m_maxError = _sample()) > m_tolerance && m_tolerance > 0.0
+            && m_step.GetSeconds() / 2.0 >= HERMITE_MIN_INTERVAL)
+        {
+            m_step = TimeStep(m_step.GetTimeStep() / 2);
+        }
+
+        NS_LOG_INFO(GetSampleCount() << " Samples every " << m_step.As(Time::S) << ", max. Error " << m_maxError << " m");
+    }
+
+
+    void SatHermiteMobilityModel::SetStart(const Time start)
+    {
+        NS_LOG_FUNCTION(this << start);
+
+        m_reference = nullptr;
+        m_samples.clear();
+        m_start = start;
+        m_step = m_interval;
+        m_maxError = 0.0;
+    }
+
+
+    void SatHermiteMobilityModel::AddSample(const Vector &position, const Vector &velocity)
+    {
+        m_samples.insert(m_samples.end(), {position.x, position.y, position.z, velocity.x, velocity.y, velocity.z});
+    }
+
+
+    size_t SatHermiteMobilityModel::GetSampleCount() const
+    {
+        return m_samples.size() / 6;
+    }
+
+
+    Time SatHermiteMobilityModel::GetEffectiveInterval() const
+    {
+        return m_step;
+    }
+
+
+    double SatHermiteMobilityModel::GetMaxError() const
+    {
+        return m_maxError;
+    }
+
+
+    void SatHermiteMobilityModel::GetStateAt(const Time time, Vector &position, Vector &velocity) const
+    {
+        _interpolate(time, position, velocity);
+    }
+
+
+    Vector SatHermiteMobilityModel::DoGetPosition() const
+    {
+        Vector position, velocity;
+        _interpolate(Simulator::Now(), position, velocity);
+        return position;
+    }
+
+
+    void SatHermiteMobilityModel::DoSetPosition(const Vector &position)
+    {
+        NS_LOG_WARN("The Position of a sampled Ephemeris cannot be set");
+    }
+
+
+    Vector SatHermiteMobilityModel::DoGetVelocity() const
+    {
+        Vector position, velocity;
+        _interpolate(Simulator::Now(), position, velocity);
+        return velocity;
+    }
+
+
+    double SatHermiteMobilityModel::_sample()
+    {
+        size_t K = m_span.GetTimeStep() / m_step.GetTimeStep() + 2;
+
+        m_samples.clear();
+        m_samples.reserve(6 * K);
+
+        Vector position, velocity;
+
+        for (size_t k = 0; k < K; k++)
+        {
+            m_reference->GetStateAt(m_start + TimeStep(m_step.GetTimeStep() * k), position, velocity);
+            AddSample(position, velocity);
+        }
+
+        // The Error Kernel of the cubic Hermite Interpolation peaks at the Midpoint
+        double error = 0.0;
+        Vector ref_pos, ref_vel;
+
+        for (size_t k = 0; k + 1 < K; k++)
+        {
+            Time t = m_start + TimeStep(m_step.GetTimeStep() * k + m_step.GetTimeStep() / 2);
+
+            m_reference->GetStateAt(t, ref_pos, ref_vel);
+            _interpolate(t, position, velocity);
+
+            error = std::max(error, CalculateDistance(position, ref_pos));
+        }
+
+        return error;
+    }
+
+
+    void SatHermiteMobilityModel::_interpolate(const Time t, Vector &position, Vector &velocity) const
+    {
+        size_t K = GetSampleCount();
+        double h = m_step.GetSeconds();
+        double x = (t - m_start).GetSeconds() / h;
+
+        if (K < 2 || x < 0.0 || x >= K - 1)
+        {
+            if (m_reference != nullptr)
+            {
+                m_reference->GetStateAt(t, position, velocity);
+                return;
+            }
+
+            NS_ASSERT_MSG(K > 0, "No Ephemeris Samples");
+
+            // Hold the outermost Sample and move it along its Velocity
+            const double *s = (x < 0.0) ? &m_samples[0] : &m_samples[6 * (K - 1)];
+            double dt = (x < 0.0) ? x * h : x * h - (K - 1) * h;
+
+            velocity = Vector(s[3], s[4], s[5]);
+            position = Vector(s[0] + s[3] * dt, s[1] + s[4] * dt, s[2] + s[5] * dt);
+            return;
+        }
+
+        size_t k = (size_t) x;
+        double tau = x - k;
+        double tau2 = tau * tau;
+        double tau3 = tau2 * tau;
+
+        // Hermite Basis for the Position and its Derivative (Velocity Terms scaled by h)
+        double h00 = 2.0 * tau3 - 3.0 * tau2 + 1.0;
+        double h10 = (tau3 - 2.0 * tau2 + tau) * h;
+        double h01 = -2.0 * tau3 + 3.0 * tau2;
+        double h11 = (tau3 - tau2) * h;
+
+        double d00 = (6.0 * tau2 - 6.0 * tau) / h;
+        double d10 = 3.0 * tau2 - 4.0 * tau + 1.0;
+        double d01 = -d00;
+        double d11 = 3.0 * tau2 - 2.0 * tau;
+
+        const double *a = &m_samples[6 * k];
+        const double *b = a + 6;
+
+        position = Vector(
+            h00 * a[0] + h10 * a[3] + h01 * b[0] + h11 * b[3],
+            h00 * a[1] + h10 * a[4] + h01 * b[1] + h11 * b[4],
+            h00 * a[2] + h10 * a[5] + h01 * b[2] + h11 * b[5]
+        );
+
+        velocity = Vector(
+            d00 * a[0] + d10 * a[3] + d01 * b[0] + d11 * b[3],
+            d00 * a[1] + d10 * a[4] + d01 * b[1] + d11 * b[4],
+            d00 * a[2] + d10 * a[5] + d01 * b[2] + d11 * b[5]
+        );
+    }
+
+
+}   /* namespace ns3 */
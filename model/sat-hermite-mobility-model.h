@@ -0,0 +1,148 @@
+/**
+ * @brief   Mobility Model interpolating sampled Ephemerides
+ *
+ * @file    sat-hermite-mobility-model.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_HERMITE_MOBILITY_MODEL_H
+#define SATELLITE_HERMITE_MOBILITY_MODEL_H
+
+
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+
+#include "sat-circular-orbit-mobility-model.h"
+
+#include <vector>
+#include <stddef.h>
+
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * Stores Position and Velocity of one Satellite at equidistant Sample Points and answers
+ * Queries by cubic Hermite Interpolation between the two neighbouring Samples. The Memory
+ * Footprint is 48 Byte per Sample, i.e. Span / SampleInterval * 48 Byte per Satellite.
+ *
+ * The Samples are either taken from a Reference Orbit (SetReference) or added one by one
+ * (AddSample), e.g. from an external Ephemeris. When sampling a Reference the Error at the
+ * Interval Midpoints (where the cubic Hermite Error peaks) is measured, and the Interval is
+ * halved until it stays below the Tolerance. Outside of the sampled Span the Reference is
+ * evaluated directly, without Reference the outermost Sample is extrapolated linearly.
+ *
+ * \brief Cubic Hermite Ephemeris Mobility Model
+ */
+class SatHermiteMobilityModel : public MobilityModel
+{
+public:
+
+    static TypeId GetTypeId();
+
+    SatHermiteMobilityModel();
+    ~SatHermiteMobilityModel();
+
+
+    /**
+     * @brief Sample a Reference Orbit over the Span, starting at the current Simulation Time
+     *
+     * @param reference     Reference Propagator
+     */
+    void SetReference(Ptr<SatCircularOrbitMobilityModel> reference);
+
+    /**
+     * @brief Drop all Samples and the Reference and start a new Series
+     *
+     * @param start     Simulation Time of the first Sample
+     */
+    void SetStart(const Time start);
+
+    /**
+     * @brief Append the next Sample, one SampleInterval after the previous one
+     *
+     * @param position  Position in m
+     * @param velocity  Velocity in m/s
+     */
+    void AddSample(const Vector &position, const Vector &velocity);
+
+
+    /**
+     * @brief Get the Number of stored Samples
+     *
+     * @return size_t
+     */
+    size_t GetSampleCount() const;
+
+    /**
+     * @brief Get the effective Sample Interval, after the Refinement against the Reference
+     *
+     * @return Time
+     */
+    Time GetEffectiveInterval() const;
+
+    /**
+     * @brief Get the largest Midpoint Deviation from the Reference
+     *
+     * @return double   Error in m, zero if no Reference was sampled
+     */
+    double GetMaxError() const;
+
+
+    /**
+     * @brief Interpolate at an arbitrary Simulation Time, without Access to the Simulator
+     *
+     * @param time      Simulation Time
+     * @param position  Position in m
+     * @param velocity  Velocity in m/s
+     */
+    void GetStateAt(const Time time, Vector &position, Vector &velocity) const;
+
+
+private:
+
+    Vector DoGetPosition() const override;
+    void DoSetPosition(const Vector &position) override;
+    Vector DoGetVelocity() const override;
+
+
+    /**
+     * @brief Sample the Reference with the current Interval
+     *
+     * @return double   largest Midpoint Deviation in m
+     */
+    double _sample();
+
+    /**
+     * @brief Interpolate Position and Velocity at a Simulation Time
+     */
+    void _interpolate(const Time t, Vector &position, Vector &velocity) const;
+
+
+    Ptr<SatCircularOrbitMobilityModel> m_reference;     //!< Reference Orbit, may be empty
+
+    Time m_interval;                //!< Requested Sample Interval
+    Time m_span;                    //!< Time covered by the Samples of a Reference
+    double m_tolerance;             //!< Max. Midpoint Error in m, zero disables the Refinement
+
+    Time m_start;                   //!< Time of the first Sample
+    Time m_step;                    //!< Effective Sample Interval
+    double m_maxError;              //!< Largest measured Midpoint Error in m
+
+    std::vector<double> m_samples;  //!< px, py, pz, vx, vy, vz per Sample
+
+};  /* SatHermiteMobilityModel */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_HERMITE_MOBILITY_MODEL_H */
@@ -17,6 +17,7 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 #include "math.h"
+#include <algorithm>
 #include "sat-isl-antenna.h"
 
 
@@ -47,7 +48,7 @@ namespace ns3
                 "MaxGainDbi"
                 , "Set the max. Gain in dBi."
                 , DoubleValue(0.0)
-                , MakeDoubleAccessor(&SatelliteISLAntenna::m_maxGainDbi)
+                , MakeDoubleAccessor(&SatelliteISLAntenna::SetMaxGainDbi, &SatelliteISLAntenna::GetMaxGainDbi)
                 , MakeDoubleChecker<double>(0.0)
             )
             .AddAttribute(
@@ -78,6 +79,8 @@ namespace ns3
 
 
     SatelliteISLAntenna::SatelliteISLAntenna()
+    : m_maxGainDbi(0.0)
+    , m_maxGainLinear(1.0)
     {
     }
 
@@ -99,6 +102,38 @@ namespace ns3
     }
 
 
+    double SatelliteISLAntenna::GetMaxGainDbi() const
+    {
+        return m_maxGainDbi;
+    }
+
+
+    void SatelliteISLAntenna::SetMaxGainDbi(const double gain)
+    {
+        m_maxGainDbi = gain;
+        m_maxGainLinear = std::pow(10.0, 0.1 * gain);
+    }
+
+
+    double SatelliteISLAntenna::GetGainLinear(const Angles &angles) const
+    {
+        double azi = std::abs(angles.GetAzimuth());
+        if (azi > m_openingAngle) return 0.0;
+
+        switch(m_pattern)
+        {
+            case RP_Cosine:
+                return std::max(0.0, std::cos(azi)) * m_maxGainLinear;
+
+            case RP_Bessel:
+            case RP_Constant:
+                return m_maxGainDbi * m_maxGainLinear;
+        }
+
+        return 0.0;
+    }
+
+
 
     double SatelliteISLAntenna::GetGainDb(Angles angles)
     {
@@ -56,6 +56,25 @@ namespace ns3
         double GetOpeningAngle() const;
 
 
+        /**
+         * @brief Get the max. Gain of the main Lobe in dBi
+         * 
+         * @return double 
+         */
+        double GetMaxGainDbi() const;
+
+        void SetMaxGainDbi(const double gain);
+
+
+        /**
+         * @brief Get the linear Gain, evaluated without Logarithms for the Link Budget
+         * 
+         * @param a         Angles relative to the main Lobe
+         * @return double   linear Gain, zero outside the Aperture
+         */
+        double GetGainLinear(const Angles &a) const;
+
+
         double GetPointingErrorDb(const double gain_db) const;
 
         Ptr<RandomVariableStream> GetPointingErrorModel();
@@ -67,6 +86,7 @@ namespace ns3
     private:
         RadiationPattern_t m_pattern;
         double m_maxGainDbi;
+        double m_maxGainLinear;     //!< m_maxGainDbi as linear Factor
         double m_openingAngle;
 
         Ptr<RandomVariableStream> m_errmodel;
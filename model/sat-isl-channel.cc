@@ -16,8 +16,13 @@
 #include "sat-isl-pck-tag.h"
 #include "ns3/double.h"
 #include "ns3/boolean.h"
+#include "ns3/nstime.h"
 #include "ns3/simulator.h"
 #include "ns3/node.h"
+#include "ns3/mobility-model.h"
+
+#include <algorithm>
+#include <limits>
 
 
 namespace ns3 
@@ -27,12 +32,24 @@ namespace ns3
     NS_OBJECT_ENSURE_REGISTERED(SatelliteISLChannel);
 
 
+    const std::size_t SatelliteISLChannel::NO_DEVICE = std::numeric_limits<std::size_t>::max();
+
+    static const uint32_t ADDR_SLOT_EMPTY = std::numeric_limits<uint32_t>::max();
+
+
     SatelliteISLChannel::SatelliteISLChannel()
     : m_bandwidth(0.0)
     // , m_compensateDoppler(true)
     , m_propDelay()
     , m_propLoss()
+    , m_indexInterval(Seconds(1))
+    , m_indexStamp(Seconds(0))
+    , m_indexMaxSpeed(0.0)
+    , m_indexDirty(true)
+    , m_broadcastRange(0.0)
     {
+        m_oracle = CreateObject<SatelliteISLLinkOracle>();
+        m_oracle->SetChannel(this);
     }
 
 
@@ -41,6 +58,19 @@ namespace ns3
     }
 
 
+    void SatelliteISLChannel::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        m_oracle->Dispose();
+        m_devices.clear();
+        m_addrTable.clear();
+        m_index.Clear();
+        m_indexDevices.clear();
+
+        Channel::DoDispose();
+    }
+
+
     TypeId SatelliteISLChannel::GetTypeId(void)
     {
         static TypeId tid = TypeId("ns3::SatelliteStaticISLChannel")
@@ -68,6 +98,35 @@ namespace ns3
                 , MakeDoubleAccessor(&SatelliteISLChannel::SetNoiseTemperature, &SatelliteISLChannel::GetNoiseTemperature)
                 , MakeDoubleChecker<double>(1.0)
             )
+            .AddAttribute(
+                "LinkStateInterval"
+                , "Interval of the Link-State Oracle to re-evaluate Rate, Delay and Feasibility of all Links."
+                  "Zero evaluates every Link on each query (exact)."
+                , TimeValue(MilliSeconds(10))
+                , MakeTimeAccessor(&SatelliteISLChannel::SetLinkStateInterval, &SatelliteISLChannel::GetLinkStateInterval)
+                , MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "SpatialIndexInterval"
+                , "Interval to rebuild the Spatial Index over the Device Positions"
+                , TimeValue(Seconds(1))
+                , MakeTimeAccessor(&SatelliteISLChannel::m_indexInterval)
+                , MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "SpatialIndexCellSize"
+                , "Edge Length of a Spatial Index Cell in m, should be close to the typical Query Range"
+                , DoubleValue(2000e3)
+                , MakeDoubleAccessor(&SatelliteISLChannel::SetSpatialIndexCellSize, &SatelliteISLChannel::GetSpatialIndexCellSize)
+                , MakeDoubleChecker<double>(1.0)
+            )
+            .AddAttribute(
+                "BroadcastRange"
+                , "Max. Range in m of the Broadcast Fan-Out, zero sends Broadcasts to all Devices"
+                , DoubleValue(0.0)
+                , MakeDoubleAccessor(&SatelliteISLChannel::m_broadcastRange)
+                , MakeDoubleChecker<double>(0.0)
+            )
         ;
 
         return tid;
@@ -114,11 +173,8 @@ namespace ns3
             return;
         }
 
-        Ptr<MobilityModel> tx_mob = sender->GetNode()->GetObject<MobilityModel>();
-        Ptr<MobilityModel> rx_mob = other->GetNode()->GetObject<MobilityModel>();
-        Time delay = m_propDelay->GetDelay(tx_mob, rx_mob);
-
         Ptr<SatelliteISLNetDevice> dev = StaticCast<SatelliteISLNetDevice>(other);
+        Time delay = GetLinkState(StaticCast<SatelliteISLNetDevice>(sender), dev).delay;
 
         Simulator::ScheduleWithContext(
             dev->GetNode()->GetId(),
@@ -133,6 +189,46 @@ namespace ns3
     }
 
 
+    void SatelliteISLChannel::Transfer(const SatelliteISLSignal &signal, Ptr<NetDevice> sender)
+    {
+        NS_LOG_FUNCTION(this << signal.GetPacket() << signal.protocol << signal.dst << signal.src << sender);
+
+        ISLPacketTag tag;
+        if (!signal.GetPacket()->PeekPacketTag(tag))
+        {
+            NS_LOG_FUNCTION(this << "Critical Error - No Pck Tag assigned!");
+            return;
+        }
+
+        Ptr<SatelliteISLNetDevice> dev = GetISLDevice(GetDeviceIndex(signal.dst.IsBroadcast() ? tag.GetSilentDst() : signal.dst));
+        if (dev == nullptr)
+        {
+            NS_LOG_ERROR("Error - Device not connected to the Channel!");
+            return;
+        }
+
+        if (m_propDelay == nullptr) 
+        {
+            NS_LOG_ERROR("Critical Error - No Delay model aggregated to Channel!");
+            return;
+        }
+
+        Time delay = GetLinkState(StaticCast<SatelliteISLNetDevice>(sender), dev).delay;
+
+        // The Receiver gets its own Copy of the Packet, the Descriptor itself is moved by Value
+        SatelliteISLSignal rx_signal = signal;
+        rx_signal.SetPacket(signal.GetPacket()->Copy());
+
+        Simulator::ScheduleWithContext(
+            dev->GetNode()->GetId(),
+            delay,
+            &SatelliteISLNetDevice::ReceiveSignal,
+            dev,
+            rx_signal
+        );
+    }
+
+
     void SatelliteISLChannel::SetPropagationDelayModel(Ptr<PropagationDelayModel> model)
     {
         NS_LOG_FUNCTION(this << model);
@@ -166,10 +262,28 @@ namespace ns3
 
         NS_LOG_FUNCTION(this << device << device->GetAddress());
 
-        uint64_t mac ;
-        device->GetAddress().CopyTo((uint8_t*) &mac);
-        m_devices.insert(std::pair{mac, device});
-        //m_devices.push_back(device);
+        uint64_t mac = _addrToHash(Mac48Address::ConvertFrom(device->GetAddress()));
+        if (GetDeviceIndex(Mac48Address::ConvertFrom(device->GetAddress())) != NO_DEVICE)
+        {
+            NS_LOG_WARN("Device " << device->GetAddress() << " is already connected to the Channel");
+            return;
+        }
+
+        // Keep the Load Factor of the Address Table below 1/2
+        if (2 * (m_devices.size() + 1) > m_addrTable.size())
+        {
+            size_t capacity = std::max<size_t>(16, 2 * m_addrTable.size());
+            m_addrTable.assign(capacity, std::pair{0, ADDR_SLOT_EMPTY});
+
+            for (uint32_t n = 0; n < m_devices.size(); n++)
+            {
+                _insertAddr(_addrToHash(Mac48Address::ConvertFrom(m_devices[n]->GetAddress())), n);
+            }
+        }
+
+        _insertAddr(mac, m_devices.size());
+        m_devices.push_back(device);
+        m_indexDirty = true;
     }
 
 
@@ -179,45 +293,152 @@ namespace ns3
     }
 
 
-    std::unordered_map<uint64_t, Ptr<SatelliteISLNetDevice>>::iterator SatelliteISLChannel::GetDevicesBegin()
+    void SatelliteISLChannel::UpdateSpatialIndex()
     {
-        return m_devices.begin();
+        NS_LOG_FUNCTION(this << m_devices.size());
+
+        std::vector<Vector> positions;
+        positions.reserve(m_devices.size());
+        m_indexDevices.clear();
+        m_indexDevices.reserve(m_devices.size());
+        m_indexMaxSpeed = 0.0;
+
+        for (const auto &dev : m_devices)
+        {
+            Ptr<MobilityModel> mob = dev->GetNode()->GetObject<MobilityModel>();
+            if (mob == nullptr) continue;
+
+            positions.push_back(mob->GetPosition());
+            m_indexDevices.push_back(dev);
+            m_indexMaxSpeed = std::max(m_indexMaxSpeed, mob->GetVelocity().GetLength());
+        }
+
+        m_index.Build(positions);
+        m_indexStamp = Simulator::Now();
+        m_indexDirty = false;
     }
 
 
-    std::unordered_map<uint64_t, Ptr<SatelliteISLNetDevice>>::iterator SatelliteISLChannel::GetDevicesEnd()
+    std::vector<Ptr<SatelliteISLNetDevice>> SatelliteISLChannel::GetDevicesInRange(const Vector &pos, const double range)
     {
-        return m_devices.end();
+        NS_LOG_FUNCTION(this << pos << range);
+
+        if (m_indexDirty || (Simulator::Now() - m_indexStamp > m_indexInterval))
+        {
+            UpdateSpatialIndex();
+        }
+
+        // Pad the Query by the Distance any Device may have moved since the Rebuild
+        double pad = m_indexMaxSpeed * (Simulator::Now() - m_indexStamp).GetSeconds();
+
+        std::vector<size_t> ids;
+        m_index.RangeQuery(pos, range + pad, ids);
+
+        std::vector<Ptr<SatelliteISLNetDevice>> result;
+        result.reserve(ids.size());
+
+        for (const size_t id : ids)
+        {
+            Ptr<SatelliteISLNetDevice> dev = m_indexDevices[id];
+            if (pad > 0.0 && CalculateDistance(dev->GetNode()->GetObject<MobilityModel>()->GetPosition(), pos) > range)
+            {
+                continue;
+            }
+            result.push_back(dev);
+        }
+
+        return result;
     }
 
 
-    Ptr<NetDevice> SatelliteISLChannel::GetDevice(std::size_t i) const
-    {   
-        if (i >= m_devices.size()) return nullptr;
+    std::vector<Ptr<SatelliteISLNetDevice>> SatelliteISLChannel::GetNearestDevices(const Vector &pos, const size_t k)
+    {
+        NS_LOG_FUNCTION(this << pos << k);
+
+        if (m_indexDirty || (Simulator::Now() - m_indexStamp > m_indexInterval))
+        {
+            UpdateSpatialIndex();
+        }
+
+        std::vector<size_t> ids;
+        m_index.NearestQuery(pos, k, ids);
 
-        auto it = m_devices.begin();
-        size_t n = 0;
-        while(it != m_devices.end())
+        std::vector<Ptr<SatelliteISLNetDevice>> result;
+        result.reserve(ids.size());
+
+        for (const size_t id : ids)
         {
-            if (n == i) return it->second;
-            it++;
-            n++;
+            result.push_back(m_indexDevices[id]);
         }
 
-        return nullptr;
+        return result;
+    }
+
+
+    void SatelliteISLChannel::SetSpatialIndexCellSize(const double size)
+    {
+        m_index.SetCellSize(size);
+        m_indexDirty = true;
+    }
+
+
+    double SatelliteISLChannel::GetSpatialIndexCellSize() const
+    {
+        return m_index.GetCellSize();
+    }
+
+
+    double SatelliteISLChannel::GetBroadcastRange() const
+    {
+        return m_broadcastRange;
+    }
+
+
+    std::vector<Ptr<SatelliteISLNetDevice>>::const_iterator SatelliteISLChannel::GetDevicesBegin() const
+    {
+        return m_devices.cbegin();
+    }
+
+
+    std::vector<Ptr<SatelliteISLNetDevice>>::const_iterator SatelliteISLChannel::GetDevicesEnd() const
+    {
+        return m_devices.cend();
+    }
+
+
+    Ptr<NetDevice> SatelliteISLChannel::GetDevice(std::size_t i) const
+    {   
+        return GetISLDevice(i);
+    }
+
+
+    Ptr<SatelliteISLNetDevice> SatelliteISLChannel::GetISLDevice(const std::size_t i) const
+    {
+        if (i >= m_devices.size()) return nullptr;
+        return m_devices[i];
     }
 
 
     Ptr<NetDevice> SatelliteISLChannel::GetDevice(const Mac48Address addr) const
     {
         NS_LOG_FUNCTION(this << addr);
+        return GetISLDevice(GetDeviceIndex(addr));
+    }
 
-        if (auto rxd = m_devices.find(_addrToHash(addr)); rxd != m_devices.end())
+
+    std::size_t SatelliteISLChannel::GetDeviceIndex(const Mac48Address addr) const
+    {
+        if (m_addrTable.empty()) return NO_DEVICE;
+
+        uint64_t key = _addrToHash(addr);
+        size_t mask = m_addrTable.size() - 1;
+
+        for (size_t slot = _addrSlot(key, mask); ; slot = (slot + 1) & mask)
         {
-            return rxd->second;
+            const auto &entry = m_addrTable[slot];
+            if (entry.second == ADDR_SLOT_EMPTY) return NO_DEVICE;
+            if (entry.first == key) return entry.second;
         }
-
-        return nullptr;
     }
 
 
@@ -229,6 +450,30 @@ namespace ns3
     }
 
 
+    Ptr<SatelliteISLLinkOracle> SatelliteISLChannel::GetLinkOracle() const
+    {
+        return m_oracle;
+    }
+
+
+    const SatelliteISLLinkOracle::LinkState& SatelliteISLChannel::GetLinkState(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx) const
+    {
+        return m_oracle->GetLinkState(tx, rx);
+    }
+
+
+    void SatelliteISLChannel::SetLinkStateInterval(const Time interval)
+    {
+        m_oracle->SetUpdateInterval(interval);
+    }
+
+
+    Time SatelliteISLChannel::GetLinkStateInterval() const
+    {
+        return m_oracle->GetUpdateInterval();
+    }
+
+
     void SatelliteISLChannel::SetNoiseTemperature(const double temp)
     {
         if (temp <= 0.0) return;
@@ -242,9 +487,30 @@ namespace ns3
     }
 
 
+    void SatelliteISLChannel::_insertAddr(const uint64_t key, const uint32_t index)
+    {
+        size_t mask = m_addrTable.size() - 1;
+        size_t slot = _addrSlot(key, mask);
+
+        while (m_addrTable[slot].second != ADDR_SLOT_EMPTY)
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        m_addrTable[slot] = std::pair{key, index};
+    }
+
+
+    size_t SatelliteISLChannel::_addrSlot(const uint64_t key, const size_t mask)
+    {
+        // Fibonacci Hashing, consecutive MAC Addresses spread over the Table
+        return (size_t) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+    }
+
+
     uint64_t SatelliteISLChannel::_addrToHash(const Mac48Address addr) const
     {
-        uint64_t hash;
+        uint64_t hash = 0;
         addr.CopyTo((uint8_t*) &hash);
         return hash;
     }
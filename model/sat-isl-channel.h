@@ -23,6 +23,8 @@
 
 #include "sat-isl-net-device.h"
 #include "sat-isl-signal.h"
+#include "sat-isl-link-oracle.h"
+#include "sat-isl-spatial-index.h"
 
 
 namespace ns3
@@ -51,9 +53,12 @@ public:
     /**
      * @brief   Transfer a Signal over the Channel
      * 
+     *          The Signal is copied by Value into the Receive Event of the Receiver.
+     * 
      * @param signal    Input Signal
+     * @param sender    Transmitting Device
      */
-    void Transfer(Ptr<SatelliteISLSignal> signal, Ptr<NetDevice> sender);
+    void Transfer(const SatelliteISLSignal &signal, Ptr<NetDevice> sender);
 
 
     void SetPropagationDelayModel(Ptr<PropagationDelayModel> model);
@@ -79,6 +84,27 @@ public:
     Ptr<NetDevice> GetDevice(const Mac48Address addr) const;
 
 
+    /**
+     * @brief Get a Device by its compact Index, the Index is stable for the Lifetime of the Channel
+     * 
+     * @param i     Device Index in [0, GetNDevices())
+     * @return Ptr<SatelliteISLNetDevice> 
+     */
+    Ptr<SatelliteISLNetDevice> GetISLDevice(const std::size_t i) const;
+
+
+    /**
+     * @brief Get the compact Index of a Device
+     * 
+     * @param addr  MAC Address of the Device
+     * @return std::size_t  Index, NO_DEVICE if the Device is not connected
+     */
+    std::size_t GetDeviceIndex(const Mac48Address addr) const;
+
+
+    static const std::size_t NO_DEVICE;
+
+
     double EstimateGain(const Ptr<MobilityModel> tx_mob, const Ptr<MobilityModel> rx_mob, double fc) const;
 
 
@@ -87,9 +113,76 @@ public:
     double GetNoiseTemperature() const;
 
 
-    std::unordered_map<uint64_t, Ptr<SatelliteISLNetDevice>>::iterator GetDevicesBegin();
+    /**
+     * @brief Get the shared Link-State Oracle of this Channel
+     * 
+     * @return Ptr<SatelliteISLLinkOracle> 
+     */
+    Ptr<SatelliteISLLinkOracle> GetLinkOracle() const;
+
+
+    /**
+     * @brief Get the cached Link-State of a directed Link
+     * 
+     * @param tx    Transmitting Device
+     * @param rx    Receiving Device
+     * @return const SatelliteISLLinkOracle::LinkState& 
+     */
+    const SatelliteISLLinkOracle::LinkState& GetLinkState(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx) const;
+
+
+    void SetLinkStateInterval(const Time interval);
+
+    Time GetLinkStateInterval() const;
+
+
+    /**
+     * @brief Get all Devices within a Range around a Position
+     * 
+     *        Candidates are taken from the Spatial Index and filtered with their current Position.
+     * 
+     * @param pos       Query Position
+     * @param range     Max. Distance in m
+     * @return std::vector<Ptr<SatelliteISLNetDevice>> 
+     */
+    std::vector<Ptr<SatelliteISLNetDevice>> GetDevicesInRange(const Vector &pos, const double range);
+
+
+    /**
+     * @brief Get the k nearest Devices around a Position, sorted by Distance
+     * 
+     *        Distances are taken from the Spatial Index Snapshot, i.e. the Order is exact
+     *        up to the Motion since the last Rebuild.
+     * 
+     * @param pos       Query Position
+     * @param k         Number of Devices
+     * @return std::vector<Ptr<SatelliteISLNetDevice>> 
+     */
+    std::vector<Ptr<SatelliteISLNetDevice>> GetNearestDevices(const Vector &pos, const size_t k);
+
+
+    /**
+     * @brief Rebuild the Spatial Index from the current Device Positions
+     */
+    void UpdateSpatialIndex();
+
+
+    void SetSpatialIndexCellSize(const double size);
+
+    double GetSpatialIndexCellSize() const;
+
 
-    std::unordered_map<uint64_t, Ptr<SatelliteISLNetDevice>>::iterator GetDevicesEnd();
+    double GetBroadcastRange() const;
+
+
+    std::vector<Ptr<SatelliteISLNetDevice>>::const_iterator GetDevicesBegin() const;
+
+    std::vector<Ptr<SatelliteISLNetDevice>>::const_iterator GetDevicesEnd() const;
+
+
+protected:
+
+    void DoDispose() override;
 
 
 private:
@@ -97,8 +190,16 @@ private:
     uint64_t _addrToHash(const Mac48Address addr) const;
     Mac48Address _hashToAddr(const uint64_t hash) const;
 
-    //std::vector<Ptr<SimpleNetDevice>> m_devices;
-    std::unordered_map<uint64_t, Ptr<SatelliteISLNetDevice>> m_devices;
+    /**
+     * @brief Insert a MAC Key into the open-addressing Address Table
+     */
+    void _insertAddr(const uint64_t key, const uint32_t index);
+
+    static size_t _addrSlot(const uint64_t key, const size_t mask);
+
+
+    std::vector<Ptr<SatelliteISLNetDevice>> m_devices;      //! Devices by compact Index
+    std::vector<std::pair<uint64_t, uint32_t>> m_addrTable; //! Flat MAC to Index Table, linear Probing
     
     double m_bandwidth;                                     //! Channel Bandwidth in Hz
    // bool m_compensateDoppler;                               //! Compensate Doppler-Shift
@@ -108,6 +209,17 @@ private:
     Ptr<PropagationDelayModel>  m_propDelay;                // Propagation Delay Model
     Ptr<PropagationLossModel>   m_propLoss;                 //! Propagation Loss Model
 
+    Ptr<SatelliteISLLinkOracle> m_oracle;                   //! Shared Link-State Oracle
+
+    SatelliteISLSpatialIndex m_index;                       //! Grid over the Device Positions
+    std::vector<Ptr<SatelliteISLNetDevice>> m_indexDevices; //! Device by Index Item
+    Time m_indexInterval;                                   //! Rebuild Interval of the Spatial Index
+    Time m_indexStamp;                                      //! Time of the last Rebuild
+    double m_indexMaxSpeed;                                 //! Max. Device Speed at the last Rebuild in m/s
+    bool m_indexDirty;                                      //! Devices changed since the last Rebuild
+
+    double m_broadcastRange;                                //! Max. Range of Broadcast Fan-Out, zero for all Devices
+
 
 };
 
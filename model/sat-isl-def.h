@@ -15,12 +15,13 @@
 #define SATELLITE_ISL_DEFINES_H
 
 #include <ctype.h>
+#include <stdint.h>
 
 namespace ns3
 {
 
-    typedef     uint16_t    satid_t;
-    typedef     uint16_t    orbid_t;
+    typedef     uint32_t    satid_t;
+    typedef     uint32_t    orbid_t;
     typedef     uint8_t     cstid_t ;
 
 
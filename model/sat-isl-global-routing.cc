@@ -0,0 +1,1003 @@
+/**
+ * @brief   Global Shortest-Path Routing over the ISL Graph
+ *
+ * @file    sat-isl-global-routing.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-isl-global-routing.h"
+#include "sat-isl-channel.h"
+#include "sat-isl-net-device.h"
+#include "sat-worker-pool.h"
+#include "ns3/sat-node-tag.h"
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/node.h"
+#include "ns3/ipv4.h"
+#include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/mobility-model.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <thread>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatISLGlobalRouting");
+    NS_OBJECT_ENSURE_REGISTERED(SatISLGlobalRouting);
+
+
+    const uint32_t SatISLGlobalRouting::NO_HOP = UINT32_MAX;
+    const size_t SatISLGlobalRouting::MAX_DEVICES = 16384;       // 16 Bytes per Pair, 4 GB
+
+    static const double SPEED_OF_LIGHT = 299792458.0;       //! Propagation Speed in m/s
+
+
+    TypeId SatISLGlobalRouting::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatISLGlobalRouting")
+            .SetParent<Object>()
+            .AddConstructor<SatISLGlobalRouting>()
+            .AddAttribute(
+                "TopologySource"
+                , "Links of the Graph: the Interconnect Matrix or the feasible Links of the Link-State Oracle"
+                , EnumValue(TOPOLOGY_ICM)
+                , MakeEnumAccessor(&SatISLGlobalRouting::m_source)
+                , MakeEnumChecker(
+                    TOPOLOGY_ICM, "ICM",
+                    TOPOLOGY_LINK_STATE, "LinkState"
+                )
+            )
+            .AddAttribute(
+                "LinkWeight"
+                , "Weight of a Link: Propagation Delay or inverse Data Rate"
+                , EnumValue(WEIGHT_DELAY)
+                , MakeEnumAccessor(&SatISLGlobalRouting::m_weight)
+                , MakeEnumChecker(
+                    WEIGHT_DELAY, "Delay",
+                    WEIGHT_INVERSE_RATE, "InverseRate"
+                )
+            )
+            .AddAttribute(
+                "Interval"
+                , "Check Interval for a new Topology Epoch (every Interval for the LinkState Source)"
+                , TimeValue(Seconds(1))
+                , MakeTimeAccessor(&SatISLGlobalRouting::m_interval)
+                , MakeTimeChecker(Time(1))
+            )
+            .AddAttribute(
+                "MaxRange"
+                , "Candidate Range of the LinkState Source in m"
+                , DoubleValue(5000e3)
+                , MakeDoubleAccessor(&SatISLGlobalRouting::m_maxRange)
+                , MakeDoubleChecker<double>(0.0)
+            )
+            .AddAttribute(
+                "Threads"
+                , "Number of Threads for the Shortest Paths, zero for all Cores (the Matrices are shared, 16 Bytes per Pair of Devices)"
+                , UintegerValue(0)
+                , MakeUintegerAccessor(&SatISLGlobalRouting::m_threads)
+                , MakeUintegerChecker<uint32_t>()
+            )
+            .AddAttribute(
+                "Incremental"
+                , "Repair the Shortest-Path Trees on Link Changes instead of recomputing them (ICM Source and LinkUp / LinkDown)"
+                , BooleanValue(true)
+                , MakeBooleanAccessor(&SatISLGlobalRouting::m_incremental)
+                , MakeBooleanChecker()
+            )
+            .AddAttribute(
+                "RefreshInterval"
+                , "Interval of full Computations in Incremental Mode to refresh the Weights of unchanged Links, zero never"
+                , TimeValue(Seconds(60))
+                , MakeTimeAccessor(&SatISLGlobalRouting::m_refresh)
+                , MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "Multipath"
+                , "Install all equal-cost Next Hops (ECMP), selected by SatelliteISLRoutingIPv4::Multipath"
+                , BooleanValue(false)
+                , MakeBooleanAccessor(&SatISLGlobalRouting::m_multipath)
+                , MakeBooleanChecker()
+            )
+            .AddAttribute(
+                "MultipathTolerance"
+                , "Relative Excess over the shortest Path Weight still counted as equal Cost"
+                , DoubleValue(0.05)
+                , MakeDoubleAccessor(&SatISLGlobalRouting::m_multipathTolerance)
+                , MakeDoubleChecker<double>(0.0)
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatISLGlobalRouting::SatISLGlobalRouting()
+    : m_channel(nullptr)
+    , m_icm(nullptr)
+    , m_source(TOPOLOGY_ICM)
+    , m_weight(WEIGHT_DELAY)
+    , m_interval(Seconds(1))
+    , m_maxRange(5000e3)
+    , m_threads(0)
+    , m_incremental(true)
+    , m_refresh(Seconds(60))
+    , m_multipath(false)
+    , m_multipathTolerance(0.05)
+    , m_icmVersion(0)
+    , m_snapshot(nullptr)
+    , m_lastFull(Seconds(0))
+    , m_links(0)
+    {
+    }
+
+
+    SatISLGlobalRouting::~SatISLGlobalRouting()
+    {
+    }
+
+
+    void SatISLGlobalRouting::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        Stop();
+        m_applyEvent.Cancel();
+        m_pool.reset();
+        m_spaces.clear();
+
+        for (auto &routing : m_routing)
+        {
+            if (routing != nullptr) routing->SetPathCallback(PathCallback());
+        }
+
+        m_channel = nullptr;
+        m_icm = nullptr;
+        m_snapshot = nullptr;
+        m_routing.clear();
+        m_deviceByAddress.clear();
+        m_out.clear();
+        m_in.clear();
+        m_dist.clear();
+        m_hop.clear();
+        m_parent.clear();
+
+        Object::DoDispose();
+    }
+
+
+    void SatISLGlobalRouting::SetChannel(Ptr<SatelliteISLChannel> channel)
+    {
+        NS_LOG_FUNCTION(this << channel);
+        m_channel = channel;
+    }
+
+
+    void SatISLGlobalRouting::SetInterconTable(Ptr<SatISLInterconTable> icm)
+    {
+        m_icm = icm;
+    }
+
+
+    Ptr<SatISLInterconTable> SatISLGlobalRouting::_getInterconTable() const
+    {
+        return (m_icm != nullptr) ? m_icm : SatISLInterconTable::Get();
+    }
+
+
+    void SatISLGlobalRouting::Start()
+    {
+        NS_LOG_FUNCTION(this);
+        Stop();
+
+        Update();
+        m_stepEvent = Simulator::Schedule(m_interval, &SatISLGlobalRouting::_step, this);
+    }
+
+
+    void SatISLGlobalRouting::Stop()
+    {
+        m_stepEvent.Cancel();
+    }
+
+
+    void SatISLGlobalRouting::_step()
+    {
+        bool refresh = m_refresh.IsStrictlyPositive() && (Simulator::Now() - m_lastFull >= m_refresh);
+
+        if (m_source != TOPOLOGY_ICM || !m_incremental || refresh)
+        {
+            if (m_source != TOPOLOGY_ICM || refresh)
+            {
+                Update();
+            }
+            else
+            {
+                // The Query commits staged ICM Changes, a new Version starts a new Epoch
+                Ptr<SatISLInterconTable> icm = _getInterconTable();
+                icm->GetSnapshot(Simulator::Now());
+
+                if (icm->GetVersion() != m_icmVersion) Update();
+            }
+        }
+        else if (!_diffInterconTable())
+        {
+            Update();
+        }
+        else
+        {
+            _applyPending();
+        }
+
+        m_stepEvent = Simulator::Schedule(m_interval, &SatISLGlobalRouting::_step, this);
+    }
+
+
+    size_t SatISLGlobalRouting::Update()
+    {
+        NS_ASSERT_MSG(m_channel != nullptr, "No Channel set");
+        NS_LOG_FUNCTION(this << m_channel->GetNDevices());
+
+        m_pendingDown.clear();
+        m_pendingUp.clear();
+        m_applyEvent.Cancel();
+
+        if (m_source == TOPOLOGY_ICM)
+        {
+            Ptr<SatISLInterconTable> icm = _getInterconTable();
+            m_snapshot = icm->GetSnapshot(Simulator::Now());
+            m_icmVersion = icm->GetVersion();
+        }
+
+        _collect();
+        _buildGraph();
+
+        const size_t N = m_positions.size();
+        NS_ABORT_MSG_IF(N > MAX_DEVICES, "Channel with " << N << " Devices exceeds the dense Path Matrices (max. " << MAX_DEVICES << ")");
+
+        m_dist.resize(N * N);
+        m_hop.resize(N * N);
+        m_parent.resize(N * N);
+
+        _parallel([this](uint32_t src, Workspace &ws) { _dijkstra(src, ws); });
+
+        m_lastFull = Simulator::Now();
+
+        size_t routes = _install();
+        NS_LOG_INFO(N << " Nodes, " << m_links << " Links, " << routes << " Routes");
+
+        return routes;
+    }
+
+
+    void SatISLGlobalRouting::_collect()
+    {
+        const size_t N = m_channel->GetNDevices();
+
+        m_positions.assign(N, Vector());
+        m_addresses.assign(N, Ipv4Address());
+        m_ifIndex.assign(N, 0);
+        m_routing.assign(N, nullptr);
+        m_satByDevice.assign(N, 0);
+        m_deviceBySat.clear();
+        m_deviceByAddress.clear();
+
+        for (size_t n = 0; n < N; n++)
+        {
+            Ptr<SatelliteISLNetDevice> dev = m_channel->GetISLDevice(n);
+            Ptr<Node> node = dev->GetNode();
+
+            Ptr<MobilityModel> mob = node->GetObject<MobilityModel>();
+            if (mob != nullptr) m_positions[n] = mob->GetPosition();
+
+            Ptr<SatelliteNodeTag> tag = node->GetObject<SatelliteNodeTag>();
+            if (tag != nullptr)
+            {
+                if (tag->GetId() >= m_deviceBySat.size()) m_deviceBySat.resize(tag->GetId() + 1, NO_HOP);
+                m_deviceBySat[tag->GetId()] = n;
+                m_satByDevice[n] = tag->GetId();
+            }
+
+            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+            if (ipv4 == nullptr) continue;
+
+            int32_t iface = ipv4->GetInterfaceForDevice(dev);
+            if (iface < 0 || ipv4->GetNAddresses(iface) == 0) continue;
+
+            m_ifIndex[n] = iface;
+            m_addresses[n] = ipv4->GetAddress(iface, 0).GetLocal();
+            m_routing[n] = DynamicCast<SatelliteISLRoutingIPv4>(ipv4->GetRoutingProtocol());
+            m_deviceByAddress[m_addresses[n].Get()] = n;
+
+            if (m_routing[n] != nullptr)
+            {
+                m_routing[n]->SetPathCallback(MakeCallback(&SatISLGlobalRouting::GetPath, this));
+            }
+        }
+    }
+
+
+    void SatISLGlobalRouting::_buildGraph()
+    {
+        const size_t N = m_positions.size();
+
+        m_out.resize(N);
+        m_in.resize(N);
+        for (auto &row : m_out) row.clear();
+        for (auto &row : m_in) row.clear();
+        m_links = 0;
+
+        if (m_source == TOPOLOGY_ICM)
+        {
+            if (m_snapshot == nullptr) return;
+
+            for (satid_t sat = 0; sat < m_deviceBySat.size() && sat <= m_snapshot->maxId; sat++)
+            {
+                if (m_deviceBySat[sat] == NO_HOP) continue;
+
+                for (uint32_t k = m_snapshot->offsets[sat]; k < m_snapshot->offsets[sat + 1]; k++)
+                {
+                    satid_t other = m_snapshot->targets[k];
+                    if (other >= m_deviceBySat.size() || m_deviceBySat[other] == NO_HOP) continue;
+
+                    uint32_t a = m_deviceBySat[sat];
+                    uint32_t b = m_deviceBySat[other];
+                    _addEdge(a, b, _weight(a, b));
+                }
+            }
+        }
+        else
+        {
+            for (size_t a = 0; a < N; a++)
+            {
+                Ptr<SatelliteISLNetDevice> dev = m_channel->GetISLDevice(a);
+
+                for (const auto &other : m_channel->GetDevicesInRange(m_positions[a], m_maxRange))
+                {
+                    if (other == dev || !m_channel->GetLinkState(dev, other).feasible) continue;
+
+                    size_t b = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(other->GetAddress()));
+                    if (b != SatelliteISLChannel::NO_DEVICE) _addEdge(a, b, _weight(a, b));
+                }
+            }
+        }
+    }
+
+
+    double SatISLGlobalRouting::_weight(const uint32_t a, const uint32_t b)
+    {
+        if (m_weight == WEIGHT_INVERSE_RATE)
+        {
+            uint64_t rate = m_channel->GetLinkState(m_channel->GetISLDevice(a), m_channel->GetISLDevice(b)).rate.GetBitRate();
+            return (rate > 0) ? 1.0 / rate : -1.0;
+        }
+
+        return CalculateDistance(m_positions[a], m_positions[b]) / SPEED_OF_LIGHT;
+    }
+
+
+    bool SatISLGlobalRouting::_addEdge(const uint32_t a, const uint32_t b, const double weight)
+    {
+        if (weight < 0.0) return false;
+
+        for (const auto &edge : m_out[a])
+        {
+            if (edge.first == b) return false;
+        }
+
+        m_out[a].emplace_back(b, weight);
+        m_in[b].emplace_back(a, weight);
+        m_links++;
+
+        return true;
+    }
+
+
+    double SatISLGlobalRouting::_removeEdge(const uint32_t a, const uint32_t b)
+    {
+        auto out = std::find_if(m_out[a].begin(), m_out[a].end(), [b](const std::pair<uint32_t, double> &e) { return e.first == b; });
+        if (out == m_out[a].end()) return -1.0;
+
+        const double weight = out->second;
+        *out = m_out[a].back();
+        m_out[a].pop_back();
+
+        auto in = std::find_if(m_in[b].begin(), m_in[b].end(), [a](const std::pair<uint32_t, double> &e) { return e.first == a; });
+        *in = m_in[b].back();
+        m_in[b].pop_back();
+
+        m_links--;
+        return weight;
+    }
+
+
+    void SatISLGlobalRouting::_parallel(const std::function<void(uint32_t, Workspace&)> &job)
+    {
+        const size_t N = m_positions.size();
+
+        size_t threads = (m_threads > 0) ? m_threads : std::max(1u, std::thread::hardware_concurrency());
+        if (m_pool == nullptr || m_pool->GetNTasks() != threads)
+        {
+            m_pool.reset(new SatWorkerPool(threads - 1));
+        }
+
+        const size_t tasks = std::max<size_t>(1, std::min(threads, N));
+        if (m_spaces.size() < tasks) m_spaces.resize(tasks);
+
+        // The Marks are only reset if the Number of Devices changed, the Stamps keep them apart
+        for (size_t t = 0; t < tasks; t++)
+        {
+            Workspace &ws = m_spaces[t];
+            if (ws.mark.size() != N)
+            {
+                ws.mark.assign(N, 0);
+                ws.stamp = 0;
+            }
+            ws.changes.clear();
+        }
+
+        // Sources are handed out one by one, the Trees differ in Size
+        std::atomic<size_t> next(0);
+
+        m_pool->Run(tasks, [this, &job, &next, N](size_t t) {
+            Workspace &ws = m_spaces[t];
+
+            for (size_t src = next++; src < N; src = next++)
+            {
+                job(src, ws);
+            }
+        });
+
+        // Rewrite the changed Routes on the calling Thread
+        std::vector<std::pair<uint32_t, uint32_t>> changes;
+        for (size_t t = 0; t < tasks; t++)
+        {
+            changes.insert(changes.end(), m_spaces[t].changes.begin(), m_spaces[t].changes.end());
+        }
+
+        if (!changes.empty()) _installChanges(changes);
+    }
+
+
+    void SatISLGlobalRouting::_installChanges(std::vector<std::pair<uint32_t, uint32_t>> &changes)
+    {
+        if (!m_multipath)
+        {
+            for (const auto &change : changes)
+            {
+                _installRoute(change.first, change.second);
+            }
+            return;
+        }
+
+        // The equal-cost Set of (s, d) depends on the Links of s and the Path Weights of its Neighbours to d
+        const size_t N = m_positions.size();
+        const size_t direct = changes.size();
+
+        // Tails of removed Links are no longer In-Neighbours, but may still route over the Head
+        std::unordered_map<uint32_t, std::vector<uint32_t>> removed;
+        for (const auto &link : m_pendingDown)
+        {
+            removed[link.b].push_back(link.a);
+        }
+
+        for (size_t i = 0; i < direct; i++)
+        {
+            const uint32_t x = changes[i].first;
+            const uint32_t d = changes[i].second;
+
+            for (const auto &edge : m_in[x])
+            {
+                changes.emplace_back(edge.first, d);
+            }
+
+            auto tails = removed.find(x);
+            if (tails == removed.end()) continue;
+
+            for (const uint32_t a : tails->second)
+            {
+                changes.emplace_back(a, d);
+            }
+        }
+
+        // With unchanged Path Weights a Link is (or was) only in the Set of its Tail towards the
+        // Destinations it leads to within the Tolerance
+        for (const auto *batch : {&m_pendingDown, &m_pendingUp})
+        {
+            for (const auto &link : *batch)
+            {
+                const double *own = m_dist.data() + link.a * N;
+                const double *via = m_dist.data() + link.b * N;
+
+                for (uint32_t d = 0; d < N; d++)
+                {
+                    if (via[d] < own[d] && link.weight + via[d] <= own[d] * (1.0 + m_multipathTolerance)) changes.emplace_back(link.a, d);
+                }
+            }
+        }
+
+        std::sort(changes.begin(), changes.end());
+        changes.erase(std::unique(changes.begin(), changes.end()), changes.end());
+
+        for (const auto &change : changes)
+        {
+            _installRoute(change.first, change.second);
+        }
+    }
+
+
+    void SatISLGlobalRouting::_dijkstra(const uint32_t src, Workspace &ws)
+    {
+        const size_t N = m_positions.size();
+        double *dist = m_dist.data() + src * N;
+        uint32_t *hop = m_hop.data() + src * N;
+        uint32_t *parent = m_parent.data() + src * N;
+
+        std::fill(dist, dist + N, std::numeric_limits<double>::infinity());
+        std::fill(hop, hop + N, NO_HOP);
+        std::fill(parent, parent + N, NO_HOP);
+
+        dist[src] = 0.0;
+        hop[src] = src;
+
+        auto later = std::greater<std::pair<double, uint32_t>>();
+
+        ws.heap.clear();
+        ws.heap.emplace_back(0.0, src);
+
+        while (!ws.heap.empty())
+        {
+            std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+            double d = ws.heap.back().first;
+            uint32_t u = ws.heap.back().second;
+            ws.heap.pop_back();
+
+            if (d > dist[u]) continue;
+
+            for (const auto &edge : m_out[u])
+            {
+                uint32_t v = edge.first;
+                double nd = d + edge.second;
+
+                if (nd < dist[v])
+                {
+                    dist[v] = nd;
+                    parent[v] = u;
+                    hop[v] = (u == src) ? v : hop[u];
+
+                    ws.heap.emplace_back(nd, v);
+                    std::push_heap(ws.heap.begin(), ws.heap.end(), later);
+                }
+            }
+        }
+    }
+
+
+    void SatISLGlobalRouting::_repair(const uint32_t src, Workspace &ws)
+    {
+        const size_t N = m_positions.size();
+        double *dist = m_dist.data() + src * N;
+        uint32_t *hop = m_hop.data() + src * N;
+        uint32_t *parent = m_parent.data() + src * N;
+
+        auto later = std::greater<std::pair<double, uint32_t>>();
+
+        // The Workspace outlives the Batches, a wrapped Stamp could match old Marks
+        if (++ws.stamp == 0)
+        {
+            std::fill(ws.mark.begin(), ws.mark.end(), 0);
+            ws.stamp = 1;
+        }
+        const uint32_t stamp = ws.stamp;
+
+        // Removed Links: only the Subtrees below removed Tree Edges lose their Paths
+        ws.affected.clear();
+        for (const auto &link : m_pendingDown)
+        {
+            if (parent[link.b] == link.a && ws.mark[link.b] != stamp)
+            {
+                ws.mark[link.b] = stamp;
+                ws.affected.push_back(link.b);
+            }
+        }
+
+        for (size_t i = 0; i < ws.affected.size(); i++)
+        {
+            uint32_t x = ws.affected[i];
+            for (const auto &edge : m_out[x])
+            {
+                if (parent[edge.first] == x && ws.mark[edge.first] != stamp)
+                {
+                    ws.mark[edge.first] = stamp;
+                    ws.affected.push_back(edge.first);
+                }
+            }
+        }
+
+        ws.oldHop.resize(ws.affected.size());
+        for (size_t i = 0; i < ws.affected.size(); i++)
+        {
+            uint32_t x = ws.affected[i];
+            ws.oldHop[i] = hop[x];
+            dist[x] = std::numeric_limits<double>::infinity();
+            hop[x] = NO_HOP;
+            parent[x] = NO_HOP;
+        }
+
+        // Unaffected Nodes keep their (still shortest) Paths and seed the Subtree
+        ws.heap.clear();
+        for (const uint32_t x : ws.affected)
+        {
+            for (const auto &edge : m_in[x])
+            {
+                uint32_t z = edge.first;
+                if (ws.mark[z] == stamp || dist[z] + edge.second >= dist[x]) continue;
+
+                dist[x] = dist[z] + edge.second;
+                parent[x] = z;
+                hop[x] = (z == src) ? x : hop[z];
+            }
+
+            if (parent[x] != NO_HOP) ws.heap.emplace_back(dist[x], x);
+        }
+
+        std::make_heap(ws.heap.begin(), ws.heap.end(), later);
+
+        while (!ws.heap.empty())
+        {
+            std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+            double d = ws.heap.back().first;
+            uint32_t u = ws.heap.back().second;
+            ws.heap.pop_back();
+
+            if (d > dist[u]) continue;
+
+            for (const auto &edge : m_out[u])
+            {
+                uint32_t v = edge.first;
+                double nd = d + edge.second;
+
+                // Unaffected Nodes only improve over added Links of the same Batch
+                if (nd < dist[v])
+                {
+                    dist[v] = nd;
+                    parent[v] = u;
+                    hop[v] = (u == src) ? v : hop[u];
+
+                    ws.heap.emplace_back(nd, v);
+                    std::push_heap(ws.heap.begin(), ws.heap.end(), later);
+                    if (ws.mark[v] != stamp) ws.changes.emplace_back(src, v);
+                }
+            }
+        }
+
+        // With Multipath also a new Path Weight changes the equal-cost Sets
+        for (size_t i = 0; i < ws.affected.size(); i++)
+        {
+            if (m_multipath || hop[ws.affected[i]] != ws.oldHop[i]) ws.changes.emplace_back(src, ws.affected[i]);
+        }
+
+        // Added Links: propagate from their Heads while the Paths improve
+        ws.heap.clear();
+        for (const auto &link : m_pendingUp)
+        {
+            double nd = dist[link.a] + link.weight;
+            if (!(nd < dist[link.b])) continue;
+
+            dist[link.b] = nd;
+            parent[link.b] = link.a;
+            hop[link.b] = (link.a == src) ? link.b : hop[link.a];
+
+            ws.heap.emplace_back(nd, link.b);
+            ws.changes.emplace_back(src, link.b);
+        }
+
+        std::make_heap(ws.heap.begin(), ws.heap.end(), later);
+
+        while (!ws.heap.empty())
+        {
+            std::pop_heap(ws.heap.begin(), ws.heap.end(), later);
+            double d = ws.heap.back().first;
+            uint32_t u = ws.heap.back().second;
+            ws.heap.pop_back();
+
+            if (d > dist[u]) continue;
+
+            for (const auto &edge : m_out[u])
+            {
+                uint32_t v = edge.first;
+                double nd = d + edge.second;
+
+                if (nd < dist[v])
+                {
+                    dist[v] = nd;
+                    parent[v] = u;
+                    hop[v] = (u == src) ? v : hop[u];
+
+                    ws.heap.emplace_back(nd, v);
+                    std::push_heap(ws.heap.begin(), ws.heap.end(), later);
+                    ws.changes.emplace_back(src, v);
+                }
+            }
+        }
+    }
+
+
+    void SatISLGlobalRouting::LinkUp(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b)
+    {
+        size_t ia = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(a->GetAddress()));
+        size_t ib = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(b->GetAddress()));
+        if (ia == SatelliteISLChannel::NO_DEVICE || ib == SatelliteISLChannel::NO_DEVICE) return;
+
+        _queue(ia, ib, true);
+        _queue(ib, ia, true);
+    }
+
+
+    void SatISLGlobalRouting::LinkDown(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b)
+    {
+        size_t ia = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(a->GetAddress()));
+        size_t ib = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(b->GetAddress()));
+        if (ia == SatelliteISLChannel::NO_DEVICE || ib == SatelliteISLChannel::NO_DEVICE) return;
+
+        _queue(ia, ib, false);
+        _queue(ib, ia, false);
+    }
+
+
+    void SatISLGlobalRouting::_queue(const uint32_t a, const uint32_t b, const bool up)
+    {
+        if (a >= m_positions.size() || b >= m_positions.size()) return;
+
+        (up ? m_pendingUp : m_pendingDown).push_back({a, b, 0.0});
+
+        // All Changes of this Time Step go into one Batch
+        if (!m_applyEvent.IsRunning())
+        {
+            m_applyEvent = Simulator::ScheduleNow(&SatISLGlobalRouting::_applyPending, this);
+        }
+    }
+
+
+    bool SatISLGlobalRouting::_diffInterconTable()
+    {
+        Ptr<SatISLInterconTable> icm = _getInterconTable();
+        Ptr<const SatISLInterconTable::Snapshot> snap = icm->GetSnapshot(Simulator::Now());
+
+        if (snap == m_snapshot) return true;
+        if (m_snapshot == nullptr || snap == nullptr || m_positions.size() != m_channel->GetNDevices()) return false;
+
+        m_icmVersion = icm->GetVersion();
+
+        // Merge the sorted Rows of both Snapshots
+        const satid_t rows = std::max(m_snapshot->maxId, snap->maxId);
+        for (satid_t sat = 0; sat <= rows && sat < m_deviceBySat.size(); sat++)
+        {
+            if (m_deviceBySat[sat] == NO_HOP) continue;
+
+            const satid_t *prev = nullptr, *prev_end = nullptr, *next = nullptr, *next_end = nullptr;
+            if (sat <= m_snapshot->maxId)
+            {
+                prev = m_snapshot->targets.data() + m_snapshot->offsets[sat];
+                prev_end = m_snapshot->targets.data() + m_snapshot->offsets[sat + 1];
+            }
+            if (sat <= snap->maxId)
+            {
+                next = snap->targets.data() + snap->offsets[sat];
+                next_end = snap->targets.data() + snap->offsets[sat + 1];
+            }
+
+            while (prev != prev_end || next != next_end)
+            {
+                satid_t other;
+                bool up;
+
+                if (next == next_end || (prev != prev_end && *prev < *next))
+                {
+                    other = *prev++;
+                    up = false;
+                }
+                else if (prev == prev_end || *next < *prev)
+                {
+                    other = *next++;
+                    up = true;
+                }
+                else
+                {
+                    prev++;
+                    next++;
+                    continue;
+                }
+
+                if (other < m_deviceBySat.size() && m_deviceBySat[other] != NO_HOP)
+                {
+                    _queue(m_deviceBySat[sat], m_deviceBySat[other], up);
+                }
+            }
+        }
+
+        m_snapshot = snap;
+        return true;
+    }
+
+
+    void SatISLGlobalRouting::_applyPending()
+    {
+        m_applyEvent.Cancel();
+        if (m_pendingDown.empty() && m_pendingUp.empty()) return;
+
+        NS_LOG_FUNCTION(this << m_pendingDown.size() << m_pendingUp.size());
+
+        // Apply the Batch to the Graph in Place, Weights of new Links from the current Positions
+        size_t down = 0;
+        for (const auto &link : m_pendingDown)
+        {
+            double weight = _removeEdge(link.a, link.b);
+            if (weight >= 0.0) m_pendingDown[down++] = {link.a, link.b, weight};
+        }
+        m_pendingDown.resize(down);
+
+        size_t up = 0;
+        for (const auto &link : m_pendingUp)
+        {
+            Ptr<MobilityModel> mob_a = m_channel->GetISLDevice(link.a)->GetNode()->GetObject<MobilityModel>();
+            Ptr<MobilityModel> mob_b = m_channel->GetISLDevice(link.b)->GetNode()->GetObject<MobilityModel>();
+            if (mob_a != nullptr) m_positions[link.a] = mob_a->GetPosition();
+            if (mob_b != nullptr) m_positions[link.b] = mob_b->GetPosition();
+
+            double weight = _weight(link.a, link.b);
+            if (_addEdge(link.a, link.b, weight)) m_pendingUp[up++] = {link.a, link.b, weight};
+        }
+        m_pendingUp.resize(up);
+
+        if (!m_pendingDown.empty() || !m_pendingUp.empty())
+        {
+            _parallel([this](uint32_t src, Workspace &ws) { _repair(src, ws); });
+        }
+
+        m_pendingDown.clear();
+        m_pendingUp.clear();
+    }
+
+
+    size_t SatISLGlobalRouting::_install()
+    {
+        const size_t N = m_positions.size();
+        const Ipv4Mask host = Ipv4Mask::GetOnes();
+        size_t routes = 0;
+
+        for (size_t s = 0; s < N; s++)
+        {
+            Ptr<SatelliteISLRoutingIPv4> routing = m_routing[s];
+            if (routing == nullptr) continue;
+
+            routing->ClearRoutingEntries();
+
+            const uint32_t *hop = m_hop.data() + s * N;
+            for (size_t d = 0; d < N; d++)
+            {
+                if (d == s || hop[d] == NO_HOP) continue;
+                if (m_addresses[d] == Ipv4Address() || m_addresses[hop[d]] == Ipv4Address()) continue;
+
+                routing->AddRoutingEntry(m_addresses[d], host, m_addresses[hop[d]], m_ifIndex[s]);
+                routes++;
+
+                if (m_multipath) routes += _installMultipath(s, d);
+            }
+        }
+
+        return routes;
+    }
+
+
+    size_t SatISLGlobalRouting::_installMultipath(const uint32_t src, const uint32_t dst)
+    {
+        const size_t N = m_positions.size();
+        const double limit = m_dist[src * N + dst] * (1.0 + m_multipathTolerance);
+        const uint32_t primary = m_hop[src * N + dst];
+        size_t routes = 0;
+
+        for (const auto &edge : m_out[src])
+        {
+            uint32_t n = edge.first;
+            double rest = m_dist[n * N + dst];
+
+            // Strictly closer to the Destination, so no Packet can loop
+            if (n == primary || m_addresses[n] == Ipv4Address()) continue;
+            if (!(rest < m_dist[src * N + dst]) || edge.second + rest > limit) continue;
+
+            m_routing[src]->AddMultipathEntry(m_addresses[dst], Ipv4Mask::GetOnes(), m_addresses[n], m_ifIndex[src]);
+            routes++;
+        }
+
+        return routes;
+    }
+
+
+    void SatISLGlobalRouting::_installRoute(const uint32_t src, const uint32_t dst)
+    {
+        Ptr<SatelliteISLRoutingIPv4> routing = m_routing[src];
+        if (routing == nullptr || src == dst || m_addresses[dst] == Ipv4Address()) return;
+
+        uint32_t hop = m_hop[src * m_positions.size() + dst];
+
+        if (hop == NO_HOP || m_addresses[hop] == Ipv4Address())
+        {
+            routing->RemoveRoutingEntry(m_addresses[dst], Ipv4Mask::GetOnes());
+        }
+        else
+        {
+            routing->AddRoutingEntry(m_addresses[dst], Ipv4Mask::GetOnes(), m_addresses[hop], m_ifIndex[src]);
+            if (m_multipath) _installMultipath(src, dst);
+        }
+    }
+
+
+    uint32_t SatISLGlobalRouting::GetNextHop(const size_t src, const size_t dst) const
+    {
+        const size_t N = m_positions.size();
+        if (src >= N || dst >= N) return NO_HOP;
+
+        return m_hop[src * N + dst];
+    }
+
+
+    double SatISLGlobalRouting::GetDistance(const size_t src, const size_t dst) const
+    {
+        const size_t N = m_positions.size();
+        if (src >= N || dst >= N) return std::numeric_limits<double>::infinity();
+
+        return m_dist[src * N + dst];
+    }
+
+
+    bool SatISLGlobalRouting::GetPath(Ipv4Address src, Ipv4Address dst, std::vector<Ipv4Address> &hops) const
+    {
+        auto s = m_deviceByAddress.find(src.Get());
+        auto d = m_deviceByAddress.find(dst.Get());
+        if (s == m_deviceByAddress.end() || d == m_deviceByAddress.end() || s->second == d->second) return false;
+
+        const size_t N = m_positions.size();
+        const uint32_t *parent = m_parent.data() + s->second * N;
+        if (m_hop[s->second * N + d->second] == NO_HOP) return false;
+
+        // Walk the Tree of the Source up from the Destination, then reverse
+        size_t first = hops.size();
+        for (uint32_t n = d->second; n != s->second; n = parent[n])
+        {
+            hops.push_back(m_addresses[n]);
+        }
+
+        std::reverse(hops.begin() + first, hops.end());
+        return true;
+    }
+
+
+    size_t SatISLGlobalRouting::GetNNodes() const
+    {
+        return m_positions.size();
+    }
+
+
+    size_t SatISLGlobalRouting::GetNLinks() const
+    {
+        return m_links;
+    }
+
+
+}   /* namespace ns3 */
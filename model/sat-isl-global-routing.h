@@ -0,0 +1,343 @@
+/**
+ * @brief   Global Shortest-Path Routing over the ISL Graph
+ *
+ * @file    sat-isl-global-routing.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ISL_GLOBAL_ROUTING_H
+#define SATELLITE_ISL_GLOBAL_ROUTING_H
+
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/vector.h"
+
+#include "sat-isl-intercon-table.h"
+#include "sat-isl-ipv4-routing.h"
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+class SatelliteISLChannel;
+class SatelliteISLNetDevice;
+class SatWorkerPool;
+
+
+/**
+ * \ingroup satellite
+ *
+ * Once per Topology Epoch the ISL Graph of a Channel is built, either from the Interconnect
+ * Matrix (ICM) or from the live Link Feasibility of the Link-State Oracle, and weighted by
+ * Propagation Delay or inverse Rate. One Dijkstra per Source runs on a Thread Pool, the
+ * First Hops are then installed in Bulk as /32 Routes into the SatelliteISLRoutingIPv4 of
+ * every Node.
+ *
+ * With the ICM as Source a new Epoch starts with a new ICM Version, otherwise every Interval.
+ *
+ * In Incremental Mode a new ICM Version is diffed against the last one and only the changed
+ * Links are applied (LinkUp / LinkDown can be fed directly, e.g. from a SatISLTopologyEngine).
+ * The Shortest-Path Trees are repaired per Source: a removed Tree Edge resets and re-solves
+ * only its Subtree, an added Edge only propagates from its Head while it improves Paths. The
+ * Routes of Destinations whose First Hop changed are rewritten, all others stay untouched.
+ * With Multipath the rewritten Pairs are those whose Path Weight changed, their upstream
+ * Neighbours towards the same Destination and, for a changed Link, its Tail towards the
+ * Destinations the Link leads to within the MultipathTolerance.
+ * Weights of unchanged Links are refreshed by a full Computation every RefreshInterval.
+ *
+ * With Multipath every Neighbour that is strictly closer to the Destination and whose Path
+ * is within the MultipathTolerance of the shortest one is installed as equal-cost Next Hop,
+ * the strict Decrease keeps the Forwarding loop-free.
+ *
+ * The Path Callback of every SatelliteISLRoutingIPv4 is bound to GetPath, so Nodes in the
+ * ROUTING_SOURCE Mode take their Source Routes from the current Trees.
+ *
+ * The Trees are kept as dense N x N Matrices (Path Weight, First Hop, Predecessor), i.e.
+ * 16 Bytes per Pair of Devices: 0.4 GB at 5000, 1.6 GB at 10000 Devices. Channels above
+ * MAX_DEVICES are rejected.
+ *
+ * \brief Global Routing of a SatelliteISLChannel
+ */
+class SatISLGlobalRouting : public Object
+{
+public:
+
+    typedef enum
+    {
+        TOPOLOGY_ICM = 0,
+        TOPOLOGY_LINK_STATE = 1
+    } topologySource_t;
+
+    typedef enum
+    {
+        WEIGHT_DELAY = 0,
+        WEIGHT_INVERSE_RATE = 1
+    } linkWeight_t;
+
+    static const uint32_t NO_HOP;       //!< No Path to the Destination
+    static const size_t MAX_DEVICES;    //!< Max. Number of Devices of the dense Path Matrices
+
+
+    static TypeId GetTypeId();
+
+    SatISLGlobalRouting();
+    ~SatISLGlobalRouting();
+
+
+    /**
+     * @brief Set the Channel whose Devices are routed
+     *
+     * @param channel
+     */
+    void SetChannel(Ptr<SatelliteISLChannel> channel);
+
+    /**
+     * @brief Set the ICM of the TOPOLOGY_ICM Source
+     *
+     * @param icm       the global ICM if not set
+     */
+    void SetInterconTable(Ptr<SatISLInterconTable> icm);
+
+
+    /**
+     * @brief Compute and install the Routes now and then once per Epoch
+     */
+    void Start();
+
+    void Stop();
+
+    /**
+     * @brief Compute and install the Routes of the current Topology
+     *
+     * @return size_t   Number of installed Routes
+     */
+    size_t Update();
+
+
+    /**
+     * @brief Get the First Hop of the last Computation
+     *
+     * @param src       Device Index of the Source
+     * @param dst       Device Index of the Destination
+     * @return uint32_t Device Index of the First Hop, NO_HOP if unreachable
+     */
+    uint32_t GetNextHop(const size_t src, const size_t dst) const;
+
+    /**
+     * @brief Get the Path Weight of the last Computation
+     *
+     * @return double   Sum of the Link Weights, infinite if unreachable
+     */
+    double GetDistance(const size_t src, const size_t dst) const;
+
+    /**
+     * @brief Get the Gateways of the Path between two ISL Addresses, O(Path Length)
+     *
+     * @param src       ISL Address of the Source
+     * @param dst       ISL Address of the Destination
+     * @param hops      Gateways after the Source, the last one is the Destination
+     * @return true     if the Destination is reachable
+     */
+    bool GetPath(Ipv4Address src, Ipv4Address dst, std::vector<Ipv4Address> &hops) const;
+
+    size_t GetNNodes() const;
+
+    size_t GetNLinks() const;
+
+
+    /**
+     * @brief Notify a new Link in both Directions, applied in one Batch with all Changes of this Time
+     *
+     *        Matches the LinkUp Trace of the SatISLTopologyEngine.
+     */
+    void LinkUp(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b);
+
+    /**
+     * @brief Notify a lost Link in both Directions, applied in one Batch with all Changes of this Time
+     *
+     *        Matches the LinkDown Trace of the SatISLTopologyEngine.
+     */
+    void LinkDown(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b);
+
+
+protected:
+
+    void DoDispose() override;
+
+
+private:
+
+    typedef std::vector<std::pair<uint32_t, double>> EdgeList;      //!< (Neighbour, Weight)
+
+    /**
+     * @brief Scratch Space of a Solver Thread
+     */
+    typedef struct
+    {
+        std::vector<std::pair<double, uint32_t>> heap;  //!< Binary Heap of (Distance, Node)
+        std::vector<uint32_t> mark;                     //!< Stamp by Node, marks the affected Subtree
+        uint32_t stamp;                                 //!< Current Stamp
+        std::vector<uint32_t> affected;                 //!< Affected Nodes of the current Source
+        std::vector<uint32_t> oldHop;                   //!< First Hop of the affected Nodes before the Repair
+        std::vector<std::pair<uint32_t, uint32_t>> changes;     //!< (Source, Destination) with a new First Hop (with Multipath: or Path Weight)
+    } Workspace;
+
+    /**
+     * @brief Link Change of a Batch
+     */
+    typedef struct
+    {
+        uint32_t a;                                     //!< Tail Device Index
+        uint32_t b;                                     //!< Head Device Index
+        double weight;                                  //!< Weight of the added or removed Link
+    } LinkChange;
+
+
+    /**
+     * @brief Periodic Check for a new Epoch
+     */
+    void _step();
+
+    /**
+     * @brief Collect Address, Interface and Routing Protocol by Device Index
+     */
+    void _collect();
+
+    /**
+     * @brief Build the weighted Graph from the Topology Source
+     */
+    void _buildGraph();
+
+    /**
+     * @brief Get the Weight of a Link from the current Positions / Rates
+     *
+     * @return double   negative if the Link has no finite Weight
+     */
+    double _weight(const uint32_t a, const uint32_t b);
+
+    bool _addEdge(const uint32_t a, const uint32_t b, const double weight);
+
+    /**
+     * @brief Remove a Link from the Graph
+     *
+     * @return double   Weight of the removed Link, negative if there was none
+     */
+    double _removeEdge(const uint32_t a, const uint32_t b);
+
+    /**
+     * @brief Run a Job once per Source on the Thread Pool
+     *
+     *        Pool and Workspaces are kept between the Calls, so a Batch of Link Changes neither
+     *        starts Threads nor reallocates the Marks.
+     */
+    void _parallel(const std::function<void(uint32_t, Workspace&)> &job);
+
+    /**
+     * @brief Shortest-Path Tree of one Source into its Rows of m_dist, m_hop and m_parent
+     */
+    void _dijkstra(const uint32_t src, Workspace &ws);
+
+    /**
+     * @brief Repair the Tree of one Source after a Batch of removed and added Links
+     */
+    void _repair(const uint32_t src, Workspace &ws);
+
+    /**
+     * @brief Queue a Link Change and schedule the Batch
+     */
+    void _queue(const uint32_t a, const uint32_t b, const bool up);
+
+    /**
+     * @brief Diff the ICM Snapshot against the last one and queue the Changes
+     *
+     * @return false    if the Snapshots are not comparable, a full Computation is needed
+     */
+    bool _diffInterconTable();
+
+    /**
+     * @brief Apply the queued Link Changes incrementally
+     */
+    void _applyPending();
+
+    size_t _install();
+
+    /**
+     * @brief Add the further equal-cost Next Hops of a Source and Destination
+     */
+    size_t _installMultipath(const uint32_t src, const uint32_t dst);
+
+    /**
+     * @brief Rewrite the Route (with Multipath its equal-cost Set) of a Source and Destination
+     */
+    void _installRoute(const uint32_t src, const uint32_t dst);
+
+    /**
+     * @brief Rewrite the Routes invalidated by the (Source, Destination) Changes of a Repair
+     */
+    void _installChanges(std::vector<std::pair<uint32_t, uint32_t>> &changes);
+
+    Ptr<SatISLInterconTable> _getInterconTable() const;
+
+
+    Ptr<SatelliteISLChannel> m_channel;
+    Ptr<SatISLInterconTable> m_icm;                 //!< ICM of the TOPOLOGY_ICM Source
+
+    topologySource_t m_source;                      //!< Topology Source
+    linkWeight_t m_weight;                          //!< Link Weight
+    Time m_interval;                                //!< Check Interval for a new Epoch
+    double m_maxRange;                              //!< Candidate Range of the TOPOLOGY_LINK_STATE Source in m
+    uint32_t m_threads;                             //!< Number of Threads, zero for all Cores
+    std::unique_ptr<SatWorkerPool> m_pool;          //!< Worker Threads, created on the first Computation
+    std::vector<Workspace> m_spaces;                //!< Workspace by Task of the Pool
+    bool m_incremental;                             //!< Repair the Trees on Link Changes
+    Time m_refresh;                                 //!< Interval of full Computations in Incremental Mode
+    bool m_multipath;                               //!< Install all equal-cost Next Hops
+    double m_multipathTolerance;                    //!< Relative Excess of a Path still counted as equal Cost
+
+    EventId m_stepEvent;                            //!< Next Epoch Check
+    EventId m_applyEvent;                           //!< Pending Batch of Link Changes
+    uint64_t m_icmVersion;                          //!< ICM Version of the last Computation
+    Ptr<const SatISLInterconTable::Snapshot> m_snapshot;    //!< ICM Snapshot of the last Computation
+    Time m_lastFull;                                //!< Time of the last full Computation
+
+    std::vector<Vector> m_positions;                //!< Position by Device Index
+    std::vector<Ipv4Address> m_addresses;           //!< ISL Address by Device Index
+    std::vector<uint32_t> m_ifIndex;                //!< ISL Interface by Device Index
+    std::vector<Ptr<SatelliteISLRoutingIPv4>> m_routing;    //!< Routing Protocol by Device Index, nullptr if none
+    std::vector<uint32_t> m_deviceBySat;            //!< Device Index by Satellite ID
+    std::vector<satid_t> m_satByDevice;             //!< Satellite ID by Device Index, zero if untagged
+    std::unordered_map<uint32_t, uint32_t> m_deviceByAddress;   //!< Device Index by ISL Address
+
+    std::vector<EdgeList> m_out;                    //!< Outgoing Links by Device Index
+    std::vector<EdgeList> m_in;                     //!< Incoming Links by Device Index
+    size_t m_links;                                 //!< Number of directed Links
+
+    std::vector<double> m_dist;                     //!< Path Weight, Row by Source
+    std::vector<uint32_t> m_hop;                    //!< First Hop, Row by Source
+    std::vector<uint32_t> m_parent;                 //!< Predecessor in the Tree, Row by Source
+
+    std::vector<LinkChange> m_pendingDown;          //!< Queued removed Links
+    std::vector<LinkChange> m_pendingUp;            //!< Queued added Links
+
+};  /* SatISLGlobalRouting */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_GLOBAL_ROUTING_H */
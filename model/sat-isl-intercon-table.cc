@@ -15,10 +15,21 @@
 #include "sat-isl-intercon-table.h"
 #include "ns3/sat-node-tag.h"
 
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <iterator>
+
 
 namespace ns3
 {
-    std::multimap<satid_t, satid_t> SatISLInterconTable::m_interconMap;
+    NS_LOG_COMPONENT_DEFINE("SatISLInterconTable");
+    NS_OBJECT_ENSURE_REGISTERED(SatISLInterconTable);
+
+
+    Ptr<SatISLInterconTable> SatISLInterconTable::m_global = nullptr;
 
 
     TypeId SatISLInterconTable::GetTypeId()
@@ -26,13 +37,44 @@ namespace ns3
         static TypeId tid = TypeId("ns3::SatISLInterconTable")
             .SetParent<Object>()
             .AddConstructor<SatISLInterconTable>()
+            .AddAttribute("BitsetLimit",
+                        "Max. Size of the Membership Bitset of a Snapshot in Bytes, larger Topologies search the sorted Rows",
+                        UintegerValue(16 * 1024 * 1024),
+                        MakeUintegerAccessor(&SatISLInterconTable::m_bitsetLimit),
+                        MakeUintegerChecker<uint64_t>()
+            )
+            .AddAttribute("MaxSnapshots",
+                        "Max. Number of kept Snapshots, past Epochs are dropped first (zero keeps all)",
+                        UintegerValue(16),
+                        MakeUintegerAccessor(&SatISLInterconTable::m_maxSnapshots),
+                        MakeUintegerChecker<uint32_t>()
+            )
         ;
 
         return tid;
     }
 
 
+    Ptr<SatISLInterconTable> SatISLInterconTable::Get()
+    {
+        if (m_global == nullptr)
+        {
+            m_global = CreateObject<SatISLInterconTable>();
+            Simulator::ScheduleDestroy([]() {
+                m_global->Dispose();
+                m_global = nullptr;
+            });
+        }
+
+        return m_global;
+    }
+
+
     SatISLInterconTable::SatISLInterconTable()
+    : m_dirty(false)
+    , m_version(0)
+    , m_bitsetLimit(16 * 1024 * 1024)
+    , m_maxSnapshots(16)
     {
     }
 
@@ -42,62 +84,316 @@ namespace ns3
     }
 
 
-    void SatISLInterconTable::Add(const satid_t src, const satid_t dst) const
+    void SatISLInterconTable::DoDispose()
+    {
+        m_staged.clear();
+        m_snapshots.clear();
+        Object::DoDispose();
+    }
+
+
+    bool SatISLInterconTable::Snapshot::Contains(const satid_t src, const satid_t dst) const
+    {
+        if (src > maxId || dst > maxId) return false;
+
+        if (!bits.empty())
+        {
+            uint64_t idx = (uint64_t) src * (maxId + 1) + dst;
+            return (bits[idx >> 6] >> (idx & 63)) & 1;
+        }
+
+        return std::binary_search(targets.data() + offsets[src], targets.data() + offsets[src + 1], dst);
+    }
+
+
+    void SatISLInterconTable::Add(const satid_t src, const satid_t dst)
     {
         NS_ASSERT_MSG(SatelliteNodeTag::GetExists(src) && SatelliteNodeTag::GetExists(dst), "Error - Trying to assign Unknown SatID to Interconnect Matrix");
 
-        m_interconMap.insert(std::pair{src, dst});
+        if (src >= m_staged.size()) m_staged.resize(src + 1);
+
+        std::vector<satid_t> &row = m_staged[src];
+        auto it = std::lower_bound(row.begin(), row.end(), dst);
+        if (it != row.end() && *it == dst) return;
+
+        row.insert(it, dst);
+        m_dirty = true;
+    }
+
+
+    void SatISLInterconTable::Remove(const satid_t src, const satid_t dst)
+    {
+        if (src >= m_staged.size()) return;
+
+        std::vector<satid_t> &row = m_staged[src];
+        auto it = std::lower_bound(row.begin(), row.end(), dst);
+        if (it == row.end() || *it != dst) return;
+
+        row.erase(it);
+        m_dirty = true;
     }
 
 
-    void SatISLInterconTable::Remove(const satid_t src, const satid_t dst) const
+    void SatISLInterconTable::RemoveAll(const satid_t src)
     {
-        // @todo: Could we speed this up with std::for_each?
-        
-        auto cons = m_interconMap.equal_range(src);
-        for(auto c = cons.first; c != cons.second; c++)
+        if (src >= m_staged.size() || m_staged[src].empty()) return;
+
+        m_staged[src].clear();
+        m_dirty = true;
+    }
+
+
+    uint64_t SatISLInterconTable::Commit()
+    {
+        return Commit(Simulator::Now());
+    }
+
+
+    uint64_t SatISLInterconTable::Commit(const Time validFrom)
+    {
+        NS_LOG_FUNCTION(this << validFrom);
+        NS_ASSERT_MSG(m_snapshots.empty() || validFrom >= m_snapshots.back()->validFrom, "Snapshots must be committed in Time Order");
+
+        Ptr<Snapshot> snap = _build(m_staged, validFrom);
+
+        // A Commit for the same Epoch replaces its Snapshot
+        if (!m_snapshots.empty() && m_snapshots.back()->validFrom == validFrom)
+        {
+            m_snapshots.back() = snap;
+        }
+        else
         {
-            if ((*c).second == dst) m_interconMap.erase(c);
+            m_snapshots.push_back(snap);
         }
+
+        m_dirty = false;
+        _prune();
+
+        return snap->version;
     }
 
 
-    void SatISLInterconTable::RemoveAll(const satid_t src) const
+    Ptr<SatISLInterconTable::Snapshot> SatISLInterconTable::_build(const Rows &rows, const Time validFrom)
     {
-        m_interconMap.erase(src);
+        Ptr<Snapshot> snap = Create<Snapshot>();
+        snap->validFrom = validFrom;
+        snap->version = ++m_version;
+        snap->maxId = rows.empty() ? 0 : rows.size() - 1;
+
+        size_t links = 0;
+        for (const auto &row : rows) links += row.size();
+
+        // Rows are kept sorted while staging, so they are copied as they are
+        snap->offsets.resize(snap->maxId + 2);
+        snap->targets.reserve(links);
+
+        for (satid_t id = 0; id <= snap->maxId; id++)
+        {
+            snap->offsets[id] = snap->targets.size();
+            if (id < rows.size())
+            {
+                snap->targets.insert(snap->targets.end(), rows[id].begin(), rows[id].end());
+            }
+        }
+        snap->offsets[snap->maxId + 1] = snap->targets.size();
+
+        uint64_t n = (uint64_t) snap->maxId + 1;
+        if (n * n / 8 <= m_bitsetLimit)
+        {
+            snap->bits.assign((n * n + 63) / 64, 0);
+
+            for (satid_t src = 0; src <= snap->maxId; src++)
+            {
+                for (uint32_t k = snap->offsets[src]; k < snap->offsets[src + 1]; k++)
+                {
+                    uint64_t idx = src * n + snap->targets[k];
+                    snap->bits[idx >> 6] |= (uint64_t) 1 << (idx & 63);
+                }
+            }
+        }
+
+        return snap;
     }
 
 
-    size_t SatISLInterconTable::GetSize() const
+    SatISLInterconTable::Rows SatISLInterconTable::_rows(const Ptr<const Snapshot> snap)
     {
-        return m_interconMap.size();
+        Rows rows;
+        if (snap == nullptr) return rows;
+
+        rows.resize(snap->maxId + 1);
+        for (satid_t id = 0; id <= snap->maxId; id++)
+        {
+            rows[id].assign(snap->targets.begin() + snap->offsets[id], snap->targets.begin() + snap->offsets[id + 1]);
+        }
+
+        return rows;
     }
 
 
-    std::pair<interconMatrixIter_t, interconMatrixIter_t> SatISLInterconTable::GetKnownNeighbours(const satid_t id)
+    Ptr<const SatISLInterconTable::Snapshot> SatISLInterconTable::GetSnapshot(const Time t)
     {
-        return m_interconMap.equal_range(id);
+        _commitPending();
+
+        auto it = std::upper_bound(m_snapshots.begin(), m_snapshots.end(), t,
+            [](const Time &t, const Ptr<const Snapshot> &snap) { return t < snap->validFrom; });
+
+        if (it == m_snapshots.begin()) return nullptr;
+
+        return *(--it);
+    }
+
+
+    Time SatISLInterconTable::GetNextChange(const Time t)
+    {
+        _commitPending();
+
+        auto it = std::upper_bound(m_snapshots.begin(), m_snapshots.end(), t,
+            [](const Time &t, const Ptr<const Snapshot> &snap) { return t < snap->validFrom; });
+
+        if (it == m_snapshots.end()) return Time::Max();
+
+        return (*it)->validFrom;
+    }
+
+
+    SatISLInterconTable::NeighbourRange SatISLInterconTable::GetKnownNeighbours(const satid_t id)
+    {
+        return GetKnownNeighbours(id, Simulator::Now());
+    }
+
+
+    SatISLInterconTable::NeighbourRange SatISLInterconTable::GetKnownNeighbours(const satid_t id, const Time t)
+    {
+        Ptr<const Snapshot> snap = GetSnapshot(t);
+        if (snap == nullptr || id > snap->maxId) return NeighbourRange{nullptr, nullptr, nullptr};
+
+        const satid_t *row = snap->targets.data();
+        return NeighbourRange{snap, row + snap->offsets[id], row + snap->offsets[id + 1]};
     }
 
 
     bool SatISLInterconTable::IsAvailable(const satid_t src, const satid_t dst)
     {
-        auto Nit = m_interconMap.equal_range(src);
-        for(auto &it = Nit.first; it != Nit.second; it++)
+        return IsAvailable(src, dst, Simulator::Now());
+    }
+
+
+    bool SatISLInterconTable::IsAvailable(const satid_t src, const satid_t dst, const Time t)
+    {
+        Ptr<const Snapshot> snap = GetSnapshot(t);
+        return snap != nullptr && snap->Contains(src, dst);
+    }
+
+
+    size_t SatISLInterconTable::GetSize()
+    {
+        Ptr<const Snapshot> snap = GetSnapshot(Simulator::Now());
+        return (snap == nullptr) ? 0 : snap->targets.size();
+    }
+
+
+    uint64_t SatISLInterconTable::GetVersion() const
+    {
+        return m_version;
+    }
+
+
+    void SatISLInterconTable::Plot(std::ostream &out)
+    {
+        Ptr<const Snapshot> snap = GetSnapshot(Simulator::Now());
+        if (snap == nullptr) return;
+
+        for (satid_t src = 0; src <= snap->maxId; src++)
+        {
+            for (uint32_t k = snap->offsets[src]; k < snap->offsets[src + 1]; k++)
+            {
+                out << src << "\t" << snap->targets[k] << "\n";
+            }
+        }
+    }
+
+
+    void SatISLInterconTable::_commitPending()
+    {
+        if (!m_dirty) return;
+
+        Time now = Simulator::Now();
+        if (m_snapshots.empty() || m_snapshots.back()->validFrom <= now)
+        {
+            Commit(now);
+            return;
+        }
+
+        NS_LOG_FUNCTION(this << now);
+
+        // Edits since the last Commit, the staged Rows started as a Copy of the latest Snapshot
+        Rows last = _rows(m_snapshots.back());
+        Rows added(m_staged.size());
+        Rows removed(last.size());
+
+        for (satid_t id = 0; id < std::max(m_staged.size(), last.size()); id++)
         {
-            if (it->second == dst) return true;
+            static const std::vector<satid_t> EMPTY;
+            const std::vector<satid_t> &now_row = (id < m_staged.size()) ? m_staged[id] : EMPTY;
+            const std::vector<satid_t> &old_row = (id < last.size()) ? last[id] : EMPTY;
+
+            if (id < added.size()) std::set_difference(now_row.begin(), now_row.end(), old_row.begin(), old_row.end(), std::back_inserter(added[id]));
+            if (id < removed.size()) std::set_difference(old_row.begin(), old_row.end(), now_row.begin(), now_row.end(), std::back_inserter(removed[id]));
         }
 
-        return false;
+        auto patch = [&added, &removed](Rows rows) {
+            if (rows.size() < added.size()) rows.resize(added.size());
+
+            for (satid_t id = 0; id < rows.size(); id++)
+            {
+                std::vector<satid_t> row;
+                if (id < removed.size()) std::set_difference(rows[id].begin(), rows[id].end(), removed[id].begin(), removed[id].end(), std::back_inserter(row));
+                else row.swap(rows[id]);
+
+                rows[id].clear();
+                if (id < added.size()) std::set_union(row.begin(), row.end(), added[id].begin(), added[id].end(), std::back_inserter(rows[id]));
+                else rows[id].swap(row);
+            }
+
+            return rows;
+        };
+
+        // The Epoch valid now is split at the current Time, the later Epochs are rebuilt in Place
+        auto later = std::upper_bound(m_snapshots.begin(), m_snapshots.end(), now,
+            [](const Time &t, const Ptr<const Snapshot> &snap) { return t < snap->validFrom; });
+
+        std::vector<Ptr<const Snapshot>> snapshots(m_snapshots.begin(), later);
+        Ptr<const Snapshot> current = snapshots.empty() ? nullptr : snapshots.back();
+
+        if (current != nullptr && current->validFrom == now) snapshots.pop_back();
+        snapshots.push_back(_build(patch(_rows(current)), now));
+
+        for (auto it = later; it != m_snapshots.end(); it++)
+        {
+            snapshots.push_back(_build(patch(_rows(*it)), (*it)->validFrom));
+        }
+
+        m_snapshots.swap(snapshots);
+        m_dirty = false;
+        _prune();
     }
 
 
-    void SatISLInterconTable::Plot(std::ostream &out)
+    void SatISLInterconTable::_prune()
     {
-        std::for_each(m_interconMap.begin(), m_interconMap.end(), 
-            [&](const auto &n) {std::cout << n.first << "\t" << n.second << "\n";} 
-        );
+        if (m_maxSnapshots == 0) return;
+
+        // Only Epochs which already ended can be dropped
+        Time now = Simulator::Now();
+        size_t drop = 0;
+
+        while (m_snapshots.size() - drop > m_maxSnapshots && m_snapshots[drop + 1]->validFrom <= now)
+        {
+            drop++;
+        }
 
+        m_snapshots.erase(m_snapshots.begin(), m_snapshots.begin() + drop);
     }
 
-}   /* namespace ns3 */
\ No newline at end of file
+}   /* namespace ns3 */
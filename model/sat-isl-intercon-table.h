@@ -17,42 +17,170 @@
 
 #include "ns3/object.h"
 #include "ns3/object-base.h"
+#include "ns3/nstime.h"
+#include "ns3/simple-ref-count.h"
 
-#include <map>
+#include <vector>
 #include "sat-isl-def.h"
 
 
 
 namespace ns3
 {
-    typedef std::multimap<satid_t, satid_t> interconMatrix_t;
-    typedef std::multimap<satid_t, satid_t>::iterator interconMatrixIter_t;
-
+    /**
+     * @brief Interconnect Matrix (ICM) of the known Satellite Neighbours
+     * 
+     *        Changes (Add, Remove, RemoveAll) are staged and turned into an immutable Snapshot
+     *        by Commit. A Snapshot is a compressed-sparse-row Adjacency (Neighbour Scans in
+     *        O(degree)) plus, up to the BitsetLimit, a Bitset Matrix (Membership in O(1),
+     *        above it a binary Search in the sorted Row). Each Snapshot is valid from its
+     *        Commit Time until the next one, so Topologies can be committed ahead of Time
+     *        and queried at any Simulation Time.
+     *
+     *        Changes which are not committed explicitly take effect at the current Simulation
+     *        Time on the next Query, in the current Epoch and in all Epochs committed ahead.
+     */
     class SatISLInterconTable : public Object
     {
     public:
+
+        /**
+         * @brief Immutable Topology of one Epoch
+         */
+        class Snapshot : public SimpleRefCount<Snapshot>
+        {
+        public:
+            Time validFrom;                     //!< Start of the Epoch
+            uint64_t version;                   //!< Increasing Version Number
+            satid_t maxId;                      //!< Largest Satellite ID in the Rows
+            std::vector<uint32_t> offsets;      //!< Row Start by Satellite ID, maxId + 2 Entries
+            std::vector<satid_t> targets;       //!< Sorted Neighbours, Row by Row
+            std::vector<uint64_t> bits;         //!< (maxId + 1)^2 Membership Bits, empty above the Limit
+
+            bool Contains(const satid_t src, const satid_t dst) const;
+        };
+
+        /**
+         * @brief Sorted Neighbours of a Satellite, holds the Snapshot the Range points into
+         */
+        struct NeighbourRange
+        {
+            Ptr<const Snapshot> snapshot;       //!< Keeps the Row alive, nullptr for an empty Range
+            const satid_t *first;               //!< First Neighbour
+            const satid_t *second;              //!< End of the Row
+
+            const satid_t* begin() const { return first; }
+            const satid_t* end() const { return second; }
+            size_t size() const { return second - first; }
+        };
+
+
         static TypeId GetTypeId();
 
+        /**
+         * @brief Get the global ICM of the current Simulation, created on Demand
+         * 
+         * @return Ptr<SatISLInterconTable> 
+         */
+        static Ptr<SatISLInterconTable> Get();
+
 
         SatISLInterconTable();
         ~SatISLInterconTable();
 
 
-        void Add(const satid_t src, const satid_t dst) const;
-        void Remove(const satid_t src, const satid_t dst) const;
-        void RemoveAll(const satid_t src) const;
+        void Add(const satid_t src, const satid_t dst);
+        void Remove(const satid_t src, const satid_t dst);
+        void RemoveAll(const satid_t src);
+
+        /**
+         * @brief Build a Snapshot from the staged Links
+         * 
+         * @param validFrom     Start of the Epoch, not before the last Snapshot
+         * @return uint64_t     Version of the new Snapshot
+         */
+        uint64_t Commit(const Time validFrom);
+
+        /**
+         * @brief Build a Snapshot valid from now
+         */
+        uint64_t Commit();
 
-        std::pair<interconMatrixIter_t, interconMatrixIter_t> GetKnownNeighbours(const satid_t id);
+
+        /**
+         * @brief Get the Snapshot valid at a Simulation Time
+         * 
+         * @return Ptr<const Snapshot>  nullptr before the first Snapshot
+         */
+        Ptr<const Snapshot> GetSnapshot(const Time t);
+
+        /**
+         * @brief Get the Start of the next Epoch after a Simulation Time
+         * 
+         * @return Time     Time::Max() if no later Snapshot is known
+         */
+        Time GetNextChange(const Time t);
+
+
+        NeighbourRange GetKnownNeighbours(const satid_t id);
+        NeighbourRange GetKnownNeighbours(const satid_t id, const Time t);
 
         bool IsAvailable(const satid_t src, const satid_t dst);
+        bool IsAvailable(const satid_t src, const satid_t dst, const Time t);
+
+        /**
+         * @brief Get the Number of Links valid now
+         */
+        size_t GetSize();
 
-        size_t GetSize() const;
+        uint64_t GetVersion() const;
 
         void Plot(std::ostream &out);
 
+
     protected:
 
-        static std::multimap<satid_t, satid_t> m_interconMap;
+        void DoDispose() override;
+
+
+    private:
+
+        typedef std::vector<std::vector<satid_t>> Rows;
+
+        /**
+         * @brief Build a Snapshot with the next Version from sorted Rows
+         */
+        Ptr<Snapshot> _build(const Rows &rows, const Time validFrom);
+
+        /**
+         * @brief Get the sorted Rows of a Snapshot, empty for nullptr
+         */
+        static Rows _rows(const Ptr<const Snapshot> snap);
+
+        /**
+         * @brief Commit staged Changes before a Query, so direct Edits keep their immediate Effect
+         *
+         *        Without Snapshots ahead of Time this is a Commit at the current Time. Otherwise
+         *        the Edits since the last Commit are applied to the current and all later Epochs.
+         */
+        void _commitPending();
+
+        /**
+         * @brief Drop Snapshots which ended before the current Simulation Time
+         */
+        void _prune();
+
+
+        Rows m_staged;                                      //!< Staged Neighbours by Satellite ID
+        bool m_dirty;                                       //!< Staged Links differ from the last Snapshot
+
+        std::vector<Ptr<const Snapshot>> m_snapshots;       //!< Snapshots ordered by validFrom
+        uint64_t m_version;                                 //!< Version of the last Snapshot
+
+        uint64_t m_bitsetLimit;                             //!< Max. Size of the Bitset Matrix in Bytes
+        uint32_t m_maxSnapshots;                            //!< Max. Number of kept Snapshots, zero keeps all
+
+        static Ptr<SatISLInterconTable> m_global;           //!< ICM of the current Simulation
 
     }; /* SatISLInterconTable */
 
@@ -12,7 +12,18 @@
 
 
 #include "sat-isl-ipv4-routing.h"
+#include "sat-isl-net-device.h"
+#include "sat-isl-route-tag.h"
+#include "ns3/sat-node-tag.h"
 #include "ns3/ipv4-routing-table-entry.h"
+#include "ns3/enum.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/socket.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <math.h>
 
 
 namespace ns3
@@ -27,6 +38,34 @@ namespace ns3
             .SetParent<Ipv4RoutingProtocol>()
             .AddConstructor<SatelliteISLRoutingIPv4>()
             .SetGroupName("Internet")
+            .AddAttribute(
+                "Mode"
+                , "Forwarding by the Routing Table or by +Grid Coordinates (see SetGrid)"
+                , EnumValue(ROUTING_TABLE)
+                , MakeEnumAccessor(&SatelliteISLRoutingIPv4::m_mode)
+                , MakeEnumChecker(
+                    ROUTING_TABLE, "Table",
+                    ROUTING_GRID, "Grid",
+                    ROUTING_SOURCE, "Source"
+                )
+            )
+            .AddAttribute(
+                "Multipath"
+                , "Selection among equal-cost Next Hops: by the Hash of the Flow or per Packet in Turn (Spraying)"
+                , EnumValue(MULTIPATH_FLOW)
+                , MakeEnumAccessor(&SatelliteISLRoutingIPv4::m_multipath)
+                , MakeEnumChecker(
+                    MULTIPATH_FLOW, "Flow",
+                    MULTIPATH_PACKET, "Packet"
+                )
+            )
+            .AddAttribute(
+                "PolarLatitude"
+                , "Latitude in Degree above which the Grid Mode detours a missing Cross-Plane Link along the Plane (as SatISLGridHelper::PolarLatitude)"
+                , DoubleValue(90.0)
+                , MakeDoubleAccessor(&SatelliteISLRoutingIPv4::m_gridPolarLatitude)
+                , MakeDoubleChecker<double>(0.0, 90.0)
+            )
         ;
 
         return tid;
@@ -34,7 +73,26 @@ namespace ns3
 
 
     SatelliteISLRoutingIPv4::SatelliteISLRoutingIPv4()
+    : m_mode(ROUTING_TABLE)
+    , m_multipath(MULTIPATH_FLOW)
+    , m_spray(0)
+    , m_hashSalt(0)
+    , m_gridPhasing(0.0)
+    , m_gridPolarLatitude(90.0)
+    , m_gridClosedSeam(true)
+    , m_gridIcm(nullptr)
+    , m_gridResolved(false)
+    , m_gridId(0)
+    , m_gridCID(0)
+    , m_gridPlane(0)
+    , m_gridSlot(0)
+    , m_gridPlanes(0)
+    , m_gridSats(0)
+    , m_gridNeighbours{0, 0, 0, 0}
+    , m_islInterface(-1)
     {
+        // Root covers the Default Route (0.0.0.0/0)
+        m_trie.push_back({0, 0, {0, 0}, -1});
     }
 
 
@@ -43,6 +101,19 @@ namespace ns3
     }
 
 
+    void SatelliteISLRoutingIPv4::DoDispose()
+    {
+        m_routes.clear();
+        m_trie.clear();
+        m_ipv4 = nullptr;
+        m_gridIcm = nullptr;
+        m_gridMobility = nullptr;
+        m_path = PathCallback();
+        _invalidate();
+        Ipv4RoutingProtocol::DoDispose();
+    }
+
+
     bool SatelliteISLRoutingIPv4::RequestRoute (uint32_t ifIndex,
                              const Ipv4Header &ipHeader,
                              Ptr<Packet> packet,
@@ -57,37 +128,28 @@ namespace ns3
                                         Ptr<NetDevice> oif,
                                         Socket::SocketErrno& sockerr)
     {
-        Ipv4Address src = header.GetSource();
         Ipv4Address dst = header.GetDestination();
-        oif = m_ipv4->GetNetDevice(1);
-
-        NS_LOG_FUNCTION(this << p << src << " to " << dst << oif);
 
-        // static Ipv4Route rt;
-        // rt.SetDestination(dst);
-        // rt.SetSource(src);
-        // rt.SetOutputDevice(oif);
-        // rt.SetGateway(Ipv4Address("10.1.1.2"));
+        NS_LOG_FUNCTION(this << p << header.GetSource() << " to " << dst << oif);
 
         Ptr<Ipv4Route> route = nullptr;
-
-        for (auto it = m_routes.begin(); it != m_routes.end(); it++)
+        if (m_mode == ROUTING_SOURCE && p != nullptr)
         {
-            Ipv4RoutingTableEntry* entry = it->first;
-
-            if (entry->GetDest() == dst)
-            {
-                route = Create<Ipv4Route>();
-                route->SetDestination(dst);
-                route->SetSource(src);
-                route->SetGateway(entry->GetGateway());
-                route->SetOutputDevice(
-                    m_ipv4->GetNetDevice(entry->GetInterface())
-                );
-            }
+            // The TTL is set when the Packet is sent, a local Packet reaches the first Hop with it
+            SocketIpTtlTag ttlTag;
+            UintegerValue ttl(64);
+            if (p->PeekPacketTag(ttlTag)) ttl.Set(ttlTag.GetTtl());
+            else m_ipv4->GetAttributeFailSafe("DefaultTtl", ttl);
+
+            ISLSourceRouteTag tag;
+            route = _sourceRoute(dst, ttl.Get(), tag);
+            if (route != nullptr && oif != nullptr && route->GetOutputDevice() != oif) route = nullptr;
+            if (route != nullptr && !p->ReplacePacketTag(tag)) p->AddPacketTag(tag);
         }
 
-
+        // The Transport Header is not added yet, so the Ingress hashes without the Ports
+        if (route == nullptr) route = LookUp(dst, oif, _flowHash(header, nullptr));
+        sockerr = (route != nullptr) ? Socket::ERROR_NOTERROR : Socket::ERROR_NOROUTETOHOST;
 
         return route;
     }
@@ -125,7 +187,24 @@ namespace ns3
             return true;
         }
 
-        Ptr<Ipv4Route> route = LookUp(header.GetDestination());
+        // Transit of a Source Route: the Hop at the TTL Position, no Lookup and the Tag stays unchanged
+        ISLSourceRouteTag tag;
+        Ptr<Ipv4Route> route = nullptr;
+
+        if (p->PeekPacketTag(tag))
+        {
+            Ipv4Address next = tag.GetNextHop(m_ipv4->GetAddress(iif, 0).GetLocal(), header.GetTtl());
+            if (next != Ipv4Address()) route = _hopRoute(next);
+        }
+        else if (m_mode == ROUTING_SOURCE && header.GetTtl() > 1)
+        {
+            // Packet Tags are Metadata, adding one to the received Packet is carried into the forwarded Copy,
+            // the Forwarding decrements the TTL before the first Hop
+            route = _sourceRoute(header.GetDestination(), header.GetTtl() - 1, tag);
+            if (route != nullptr) p->AddPacketTag(tag);
+        }
+
+        if (route == nullptr) route = LookUp(header.GetDestination(), nullptr, _flowHash(header, p));
         if (route)
         {
             NS_LOG_FUNCTION(this << "Unicast Fwd!");
@@ -140,24 +219,28 @@ namespace ns3
     void SatelliteISLRoutingIPv4::NotifyInterfaceUp(uint32_t interface)
     {
         NS_LOG_FUNCTION(this);
+        _invalidate();
     }
 
 
     void SatelliteISLRoutingIPv4::NotifyInterfaceDown(uint32_t interface)
     {
         NS_LOG_FUNCTION(this);
+        _invalidate();
     }
 
 
     void SatelliteISLRoutingIPv4::NotifyAddAddress(uint32_t interface, Ipv4InterfaceAddress address)
     {
         NS_LOG_FUNCTION(this);
+        _invalidate();
     }
 
 
     void SatelliteISLRoutingIPv4::NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress address)
     {
         NS_LOG_FUNCTION(this);
+        _invalidate();
     }
 
 
@@ -165,6 +248,11 @@ namespace ns3
     {
         NS_LOG_FUNCTION(this);
         m_ipv4 = ipv4;
+
+        Ptr<Node> node = (ipv4 != nullptr) ? ipv4->GetObject<Node>() : nullptr;
+        m_hashSalt = (node != nullptr) ? node->GetId() : 0;
+
+        _invalidate();
     }
 
 
@@ -176,46 +264,510 @@ namespace ns3
 
     void SatelliteISLRoutingIPv4::AddRoutingEntry(Ipv4Address network, Ipv4Mask netmask, Ipv4Address nexthop, uint32_t interface)
     {
-        Ipv4RoutingTableEntry route = 
-            Ipv4RoutingTableEntry::CreateNetworkRouteTo(network, netmask, nexthop, interface);
-        
-        Ipv4RoutingTableEntry* route_p = new Ipv4RoutingTableEntry(route);
-        m_routes.emplace_back(route_p, 5);
+        NS_LOG_FUNCTION(this << network << netmask << nexthop << interface);
+        NS_ASSERT_MSG(m_routes.size() < INT32_MAX, "Too many Routes");
+
+        uint8_t length = netmask.GetPrefixLength();
+        uint32_t prefix = network.Get() & _mask(length);
+
+        RouteEntry route;
+        route.entries.push_back(Ipv4RoutingTableEntry::CreateNetworkRouteTo(Ipv4Address(prefix), netmask, nexthop, interface));
+        route.routes.push_back(nullptr);
 
+        m_routes.push_back(route);
+        _insert(prefix, length, m_routes.size() - 1);
     }
 
-    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::LookUp(Ipv4Address dst, Ptr<NetDevice> oif)
+
+    bool SatelliteISLRoutingIPv4::RemoveRoutingEntry(Ipv4Address network, Ipv4Mask netmask)
     {
-        Ptr<Ipv4Route> route = nullptr;
+        NS_LOG_FUNCTION(this << network << netmask);
+
+        uint8_t length = netmask.GetPrefixLength();
+        uint32_t n = _find(network.Get() & _mask(length), length);
+        if (n == UINT32_MAX || m_trie[n].entry < 0) return false;
+
+        // The last Route takes the freed Slot, the Node of the Prefix only branches from now on
+        int32_t entry = m_trie[n].entry;
+        int32_t last = m_routes.size() - 1;
+        m_trie[n].entry = -1;
+
+        if (entry != last)
+        {
+            m_routes[entry] = m_routes[last];
+
+            const Ipv4RoutingTableEntry &moved = m_routes[entry].entries.front();
+            uint8_t moved_length = moved.GetDestNetworkMask().GetPrefixLength();
+            m_trie[_find(moved.GetDestNetwork().Get(), moved_length)].entry = entry;
+        }
+
+        m_routes.pop_back();
+        return true;
+    }
+
+
+    void SatelliteISLRoutingIPv4::AddMultipathEntry(Ipv4Address network, Ipv4Mask netmask, Ipv4Address nexthop, uint32_t interface)
+    {
+        NS_LOG_FUNCTION(this << network << netmask << nexthop << interface);
+
+        uint8_t length = netmask.GetPrefixLength();
+        uint32_t prefix = network.Get() & _mask(length);
+
+        uint32_t n = _find(prefix, length);
+        if (n == UINT32_MAX || m_trie[n].entry < 0)
+        {
+            AddRoutingEntry(network, netmask, nexthop, interface);
+            return;
+        }
+
+        RouteEntry &route = m_routes[m_trie[n].entry];
+        for (const auto &entry : route.entries)
+        {
+            if (entry.GetGateway() == nexthop && entry.GetInterface() == interface) return;
+        }
+
+        route.entries.push_back(Ipv4RoutingTableEntry::CreateNetworkRouteTo(Ipv4Address(prefix), netmask, nexthop, interface));
+        route.routes.push_back(nullptr);
+    }
 
+
+    void SatelliteISLRoutingIPv4::ClearRoutingEntries()
+    {
+        NS_LOG_FUNCTION(this << m_routes.size());
+
+        m_routes.clear();
+        m_trie.resize(1);
+        m_trie[0] = {0, 0, {0, 0}, -1};
+    }
+
+
+    size_t SatelliteISLRoutingIPv4::GetNRoutes() const
+    {
+        return m_routes.size();
+    }
+
+
+    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::LookUp(Ipv4Address dst, Ptr<NetDevice> oif, const uint32_t flow)
+    {
         if (dst.IsLocalMulticast())
         {
             NS_LOG_FUNCTION(this << "Multicast not implemented!");
         }
 
-        for (auto it = m_routes.begin(); it != m_routes.end(); it++)
+        if (m_mode == ROUTING_GRID)
+        {
+            Ptr<Ipv4Route> route = _gridLookUp(dst);
+            if (route != nullptr && (oif == nullptr || route->GetOutputDevice() == oif)) return route;
+        }
+
+        // Walk down as long as the Prefixes match, the deepest Entry is the longest Match
+        uint32_t addr = dst.Get();
+        int32_t best = m_trie[0].entry;
+        uint32_t n = 0;
+
+        while (m_trie[n].length < 32)
+        {
+            uint32_t c = m_trie[n].child[(addr >> (31 - m_trie[n].length)) & 1];
+            if (c == 0) break;
+
+            const TrieNode &child = m_trie[c];
+            if ((addr ^ child.prefix) & _mask(child.length)) break;
+
+            if (child.entry >= 0) best = child.entry;
+            n = c;
+        }
+
+        if (best < 0) return nullptr;
+
+        RouteEntry &match = m_routes[best];
+
+        const size_t count = match.entries.size();
+        size_t first = 0;
+        if (count > 1)
+        {
+            first = (m_multipath == MULTIPATH_PACKET) ? (m_spray++ % count) : (flow % count);
+        }
+
+        // The selected Next Hop first, the others only if it does not use the Output Device
+        for (size_t k = 0; k < count; k++)
+        {
+            size_t c = (first + k) % count;
+
+            if (match.routes[c] == nullptr)
+            {
+                const Ipv4RoutingTableEntry &tble = match.entries[c];
+                uint32_t itfn = tble.GetInterface();
+
+                match.routes[c] = Create<Ipv4Route>();
+                match.routes[c]->SetDestination(tble.GetDest());
+                match.routes[c]->SetGateway(tble.GetGateway());
+                match.routes[c]->SetSource(m_ipv4->SourceAddressSelection(itfn, tble.GetDest()));
+                match.routes[c]->SetOutputDevice(m_ipv4->GetNetDevice(itfn));
+            }
+
+            if (oif == nullptr || match.routes[c]->GetOutputDevice() == oif) return match.routes[c];
+        }
+
+        NS_LOG_FUNCTION(this << "Longest Match does not use the Output Device " << oif);
+        return nullptr;
+    }
+
+
+    uint32_t SatelliteISLRoutingIPv4::_mask(const uint8_t length)
+    {
+        return (length == 0) ? 0 : (0xFFFFFFFF << (32 - length));
+    }
+
+
+    void SatelliteISLRoutingIPv4::_insert(const uint32_t prefix, const uint8_t length, const int32_t entry)
+    {
+        uint32_t n = 0;
+
+        // Invariant: Node n matches the Prefix on its Length, which is at most the Length
+        while (true)
+        {
+            if (m_trie[n].length == length)
+            {
+                // Same Prefix, the new Route (always the last one) takes the Slot of the old one
+                if (m_trie[n].entry >= 0 && m_trie[n].entry != entry)
+                {
+                    m_routes[m_trie[n].entry] = m_routes[entry];
+                    m_routes.pop_back();
+                    return;
+                }
+
+                m_trie[n].entry = entry;
+                return;
+            }
+
+            int bit = (prefix >> (31 - m_trie[n].length)) & 1;
+            uint32_t c = m_trie[n].child[bit];
+
+            if (c == 0)
+            {
+                m_trie.push_back({prefix, length, {0, 0}, entry});
+                m_trie[n].child[bit] = m_trie.size() - 1;
+                return;
+            }
+
+            // Common Bits of the Prefix and the Child, at least one more than Node n
+            uint32_t diff = prefix ^ m_trie[c].prefix;
+            uint8_t common = (diff == 0) ? 32 : __builtin_clz(diff);
+            common = std::min(common, std::min(length, m_trie[c].length));
+
+            if (common == m_trie[c].length)
+            {
+                n = c;
+                continue;
+            }
+
+            // Split the Edge to the Child at the first differing Bit
+            uint32_t split = m_trie.size();
+            m_trie.push_back({prefix & _mask(common), common, {0, 0}, -1});
+            m_trie[split].child[(m_trie[c].prefix >> (31 - common)) & 1] = c;
+            m_trie[n].child[bit] = split;
+
+            if (common == length)
+            {
+                m_trie[split].entry = entry;
+            }
+            else
+            {
+                m_trie.push_back({prefix, length, {0, 0}, entry});
+                m_trie[split].child[(prefix >> (31 - common)) & 1] = m_trie.size() - 1;
+            }
+
+            return;
+        }
+    }
+
+
+    uint32_t SatelliteISLRoutingIPv4::_find(const uint32_t prefix, const uint8_t length) const
+    {
+        uint32_t n = 0;
+
+        while (m_trie[n].length < length)
+        {
+            uint32_t c = m_trie[n].child[(prefix >> (31 - m_trie[n].length)) & 1];
+            if (c == 0 || m_trie[c].length > length) return UINT32_MAX;
+            if ((prefix ^ m_trie[c].prefix) & _mask(m_trie[c].length)) return UINT32_MAX;
+
+            n = c;
+        }
+
+        return n;
+    }
+
+
+    void SatelliteISLRoutingIPv4::_invalidate()
+    {
+        for (auto &route : m_routes)
+        {
+            std::fill(route.routes.begin(), route.routes.end(), nullptr);
+        }
+
+        // Interfaces and Addresses may have changed, the Grid is resolved again on the next Packet
+        m_gridResolved = false;
+        for (auto &route : m_gridRoutes)
+        {
+            route = nullptr;
+        }
+
+        m_hopRoutes.clear();
+        m_islInterface = -1;
+    }
+
+
+    uint32_t SatelliteISLRoutingIPv4::_flowHash(const Ipv4Header &header, Ptr<const Packet> p) const
+    {
+        uint64_t key = ((uint64_t) header.GetSource().Get() << 32) | header.GetDestination().Get();
+        uint64_t ports = header.GetProtocol();
+
+        // Source and Destination Port lead the TCP and UDP Header. Only later Fragments lack them, but
+        // all Fragments of a Datagram must take the same Path, so no Fragment hashes the Ports
+        const uint8_t proto = header.GetProtocol();
+        const bool fragment = !header.IsLastFragment() || header.GetFragmentOffset() != 0;
+        if (p != nullptr && (proto == 6 || proto == 17) && !fragment && p->GetSize() >= 4)
+        {
+            uint8_t buff[4];
+            p->CopyData(buff, 4);
+            ports |= ((uint64_t) buff[0] << 32) | ((uint64_t) buff[1] << 24) | ((uint64_t) buff[2] << 16) | ((uint64_t) buff[3] << 8);
+        }
+
+        // SplitMix64 Finalizer
+        uint64_t h = key ^ (ports * 0x9E3779B97F4A7C15ULL) ^ (m_hashSalt << 48);
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+        h ^= h >> 31;
+
+        return (uint32_t) h;
+    }
+
+
+    void SatelliteISLRoutingIPv4::SetGrid(const double phasing, const bool closedSeam, const Ipv4Address base, Ptr<SatISLInterconTable> icm)
+    {
+        NS_LOG_FUNCTION(this << phasing << closedSeam << base);
+
+        m_gridPhasing = phasing;
+        m_gridClosedSeam = closedSeam;
+        m_gridBase = base;
+        m_gridIcm = icm;
+
+        _invalidate();
+    }
+
+
+    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::_gridLookUp(Ipv4Address dst)
+    {
+        if (!m_gridResolved && !_gridResolve()) return nullptr;
+
+        // ISL Addresses are base + Satellite ID
+        if (dst.Get() <= m_gridBase.Get()) return nullptr;
+
+        satid_t id = dst.Get() - m_gridBase.Get();
+        uint32_t plane, slot;
+        if (id == m_gridId || !_gridCoordinates(id, plane, slot)) return nullptr;
+
+        // Cross-Plane Hops, the shorter Way around on a closed Seam
+        int h = (int) plane - (int) m_gridPlane;
+        if (m_gridClosedSeam)
+        {
+            int east = (h + (int) m_gridPlanes) % (int) m_gridPlanes;
+            h = (east <= (int) m_gridPlanes - east) ? east : east - (int) m_gridPlanes;
+        }
+
+        if (h != 0)
         {
-            Ipv4Address entry = (*it->first).GetDestNetwork();
-            Ipv4Mask mask = (*it->first).GetDestNetworkMask();
+            gridDirection_t side = (h > 0) ? GRID_EAST : GRID_WEST;
+            satid_t next = m_gridNeighbours[side];
+
+            if (next == 0) return nullptr;
 
-            if (mask.IsMatch(dst, entry))
+            Ptr<SatISLInterconTable> icm = (m_gridIcm != nullptr) ? m_gridIcm : SatISLInterconTable::Get();
+            if (icm->IsAvailable(m_gridId, next)) return _gridRoute(side);
+
+            // Polar Shutdown: along the Plane towards the Equator until the Cross-Plane Links are back
+            Vector pos = m_gridMobility->GetPosition();
+            Ptr<Node> peer = SatelliteRegistry::Get()->GetSatellite(next);
+            Ptr<MobilityModel> peer_mob = (peer != nullptr) ? peer->GetObject<MobilityModel>() : nullptr;
+
+            if (_gridPolar(pos) || (peer_mob != nullptr && _gridPolar(peer_mob->GetPosition())))
+            {
+                Vector vel = m_gridMobility->GetVelocity();
+                return _gridRoute((pos.z * vel.z < 0.0) ? GRID_FORE : GRID_AFT);
+            }
+
+            // Missing for another Reason (e.g. a failed Link), the Table decides
+            return nullptr;
+        }
+
+        // Within the Plane of the Destination, the shorter Way around
+        int v = ((int) slot - (int) m_gridSlot + (int) m_gridSats) % (int) m_gridSats;
+        return _gridRoute((v <= (int) m_gridSats - v) ? GRID_FORE : GRID_AFT);
+    }
+
+
+    bool SatelliteISLRoutingIPv4::_gridResolve()
+    {
+        if (m_ipv4 == nullptr) return false;
+
+        Ptr<Node> node = m_ipv4->GetObject<Node>();
+        Ptr<SatelliteNodeTag> tag = (node != nullptr) ? node->GetObject<SatelliteNodeTag>() : nullptr;
+        m_gridMobility = (node != nullptr) ? node->GetObject<MobilityModel>() : nullptr;
+        if (tag == nullptr || m_gridMobility == nullptr) return false;
+
+        if (_getISLInterface() < 0) return false;
+
+        m_gridId = tag->GetId();
+        m_gridCID = tag->GetCID();
+        m_gridPlanes = SatelliteNodeTag::OrbitsByConstellation(m_gridCID).size();
+        m_gridSats = SatelliteNodeTag::GetSatsN(tag->GetOID());
+
+        if (m_gridPlanes == 0 || m_gridSats == 0 || !_gridCoordinates(m_gridId, m_gridPlane, m_gridSlot)) return false;
+
+        const std::vector<orbid_t> &orbits = SatelliteNodeTag::OrbitsByConstellation(m_gridCID);
+        const uint32_t P = m_gridPlanes, S = m_gridSats;
+        const uint32_t p = m_gridPlane, s = m_gridSlot;
+
+        m_gridNeighbours[GRID_FORE] = SatelliteNodeTag::SatsByOrbit(orbits[p])[(s + 1) % S];
+        m_gridNeighbours[GRID_AFT] = SatelliteNodeTag::SatsByOrbit(orbits[p])[(s + S - 1) % S];
+        m_gridNeighbours[GRID_WEST] = 0;
+        m_gridNeighbours[GRID_EAST] = 0;
+
+        // Nearest Slot of the neighbouring Planes, as linked by the SatISLGridHelper from West to East
+        auto offset = [this, S](const uint32_t from, const uint32_t to) {
+            double shift = fmod(_gridPhase(from, 0) - _gridPhase(to, 0) + 2.0 * S, (double) S);
+            return ((uint32_t) lround(shift)) % S;
+        };
+
+        if (p + 1 < P || (m_gridClosedSeam && P > 2))
+        {
+            uint32_t q = (p + 1) % P;
+            if (SatelliteNodeTag::GetSatsN(orbits[q]) == S)
+            {
+                m_gridNeighbours[GRID_EAST] = SatelliteNodeTag::SatsByOrbit(orbits[q])[(s + offset(p, q)) % S];
+            }
+        }
+
+        if (p > 0 || (m_gridClosedSeam && P > 2))
+        {
+            uint32_t q = (p + P - 1) % P;
+            if (SatelliteNodeTag::GetSatsN(orbits[q]) == S)
             {
-                NS_LOG_FUNCTION(this << "Found a match!");
-                
-                Ipv4RoutingTableEntry *tble = (it->first);
-                route = Create<Ipv4Route>();
-                route->SetDestination(tble->GetDest());
-                route->SetGateway(tble->GetGateway());
-
-                uint32_t itfn = tble->GetInterface();
-                Ipv4Address saddr = m_ipv4->SourceAddressSelection(itfn, tble->GetDest());
-                route->SetSource(saddr); //m_ipv4->SourceAddressSelection(tble->GetInterface(), tble->GetDest()));
-                route->SetOutputDevice(m_ipv4->GetNetDevice(tble->GetInterface()));
+                m_gridNeighbours[GRID_WEST] = SatelliteNodeTag::SatsByOrbit(orbits[q])[(s + S - offset(q, p)) % S];
             }
         }
 
+        m_gridResolved = true;
+        return true;
+    }
+
+
+    bool SatelliteISLRoutingIPv4::_gridCoordinates(const satid_t id, uint32_t &plane, uint32_t &slot) const
+    {
+        Ptr<SatelliteNodeTag> tag = SatelliteRegistry::Get()->GetTag(id);
+        if (tag == nullptr || tag->GetCID() != m_gridCID) return false;
+
+        // Orbits and Satellites are registered consecutively by the Walker Helpers
+        const std::vector<orbid_t> &orbits = SatelliteNodeTag::OrbitsByConstellation(m_gridCID);
+        const std::vector<satid_t> &sats = SatelliteNodeTag::SatsByOrbit(tag->GetOID());
+
+        plane = tag->GetOID() - orbits.front();
+        slot = id - sats.front();
+
+        return plane < orbits.size() && orbits[plane] == tag->GetOID()
+            && slot < sats.size() && sats[slot] == id && sats.size() == m_gridSats;
+    }
+
+
+    bool SatelliteISLRoutingIPv4::_gridPolar(const Vector &pos) const
+    {
+        double r = sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z);
+        if (r <= 0.0) return false;
+
+        return fabs(asin(pos.z / r)) * 180.0 / M_PI >= m_gridPolarLatitude;
+    }
+
+
+    double SatelliteISLRoutingIPv4::_gridPhase(const uint32_t plane, const uint32_t slot) const
+    {
+        double phase = fmod(360.0 - fmod(plane * m_gridPhasing, 360.0), 360.0);
+        return slot + phase * m_gridSats / 360.0;
+    }
+
+
+    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::_gridRoute(const gridDirection_t direction)
+    {
+        satid_t next = m_gridNeighbours[direction];
+        if (next == 0) return nullptr;
+
+        if (m_gridRoutes[direction] == nullptr)
+        {
+            m_gridRoutes[direction] = _hopRoute(Ipv4Address(m_gridBase.Get() + next));
+        }
+
+        return m_gridRoutes[direction];
+    }
+
+
+
+    void SatelliteISLRoutingIPv4::SetPathCallback(PathCallback path)
+    {
+        NS_LOG_FUNCTION(this);
+        m_path = path;
+    }
+
+
+    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::_sourceRoute(Ipv4Address dst, uint8_t ttl, ISLSourceRouteTag &tag)
+    {
+        if (m_path.IsNull() || _getISLInterface() < 0) return nullptr;
+
+        Ipv4Address self = m_ipv4->GetAddress(m_islInterface, 0).GetLocal();
+
+        m_pathBuffer.clear();
+        if (!m_path(self, dst, m_pathBuffer) || m_pathBuffer.empty() || m_pathBuffer.size() > ISLSourceRouteTag::MAX_HOPS) return nullptr;
+
+        tag.SetHops(m_pathBuffer, ttl);
+
+        return _hopRoute(tag.GetFirstHop());
+    }
+
+
+    Ptr<Ipv4Route> SatelliteISLRoutingIPv4::_hopRoute(Ipv4Address gateway)
+    {
+        for (const auto &route : m_hopRoutes)
+        {
+            if (route->GetGateway() == gateway) return route;
+        }
+
+        if (_getISLInterface() < 0) return nullptr;
+
+        Ptr<Ipv4Route> route = Create<Ipv4Route>();
+        route->SetDestination(gateway);
+        route->SetGateway(gateway);
+        route->SetSource(m_ipv4->SourceAddressSelection(m_islInterface, gateway));
+        route->SetOutputDevice(m_ipv4->GetNetDevice(m_islInterface));
+
+        m_hopRoutes.push_back(route);
         return route;
     }
 
 
+    int32_t SatelliteISLRoutingIPv4::_getISLInterface()
+    {
+        if (m_islInterface >= 0 || m_ipv4 == nullptr) return m_islInterface;
+
+        for (uint32_t n = 0; n < m_ipv4->GetNInterfaces(); n++)
+        {
+            if (DynamicCast<SatelliteISLNetDevice>(m_ipv4->GetNetDevice(n)) != nullptr && m_ipv4->GetNAddresses(n) > 0)
+            {
+                m_islInterface = n;
+                break;
+            }
+        }
+
+        return m_islInterface;
+    }
+
+
 }   /* namespace ns3 */
\ No newline at end of file
@@ -19,6 +19,15 @@
 #include <ns3/ipv4.h>
 #include <ns3/ipv4-routing-protocol.h>
 #include <ns3/ipv4-l3-protocol.h>
+#include <ns3/ipv4-routing-table-entry.h>
+#include <ns3/mobility-model.h>
+
+#include "sat-isl-def.h"
+#include "sat-isl-intercon-table.h"
+#include "sat-isl-route-tag.h"
+
+#include <vector>
+#include <stdint.h>
 
 
 namespace ns3
@@ -26,11 +35,50 @@ namespace ns3
 
     typedef Callback<void, bool, const Ipv4Route&, Ptr<Packet>, const Ipv4Header&> RouteReplyCallback;
 
-
+    /**
+     * @brief Path Computation of the Source Routing: (Source, Destination, Gateways of the Path)
+     */
+    typedef Callback<bool, Ipv4Address, Ipv4Address, std::vector<Ipv4Address>&> PathCallback;
+
+
+    /**
+     * @brief Routing of Satellite ISL Interfaces
+     *
+     *        ROUTING_TABLE forwards by Longest-Prefix Match over the installed Routes. A Prefix
+     *        may have several equal-cost Next Hops (AddMultipathEntry): a Flow is hashed by its
+     *        5-Tuple to one of them, or every Packet takes the next one (Multipath Attribute).
+     *
+     *        ROUTING_GRID forwards within a Walker +Grid without any Table: the Next Hop
+     *        follows from the (Plane, Slot) Coordinates of the own and the destination
+     *        Satellite, taken from the SatelliteNodeTag (CID / OID / ID) and the Registry.
+     *        Cross-Plane Hops come first, the shorter Way around on a closed Seam. A Cross-Plane
+     *        Link missing in the ICM while this Satellite or its Peer is above the PolarLatitude
+     *        (Polar Shutdown) diverts along the Plane towards the Equator until the Cross-Plane
+     *        Links are back. Other missing Links and Destinations outside the Grid fall back to
+     *        the Routing Table.
+     *
+     *        ROUTING_SOURCE computes the full Path once at the Ingress Satellite (PathCallback)
+     *        and attaches it as ISLSourceRouteTag. Every Node forwards a tagged Packet to the
+     *        Hop at its TTL Position without a Lookup, independent of its Mode.
+     */
     class SatelliteISLRoutingIPv4 : public Ipv4RoutingProtocol
     {
     public:
 
+        typedef enum
+        {
+            ROUTING_TABLE = 0,
+            ROUTING_GRID = 1,
+            ROUTING_SOURCE = 2
+        } routingMode_t;
+
+        typedef enum
+        {
+            MULTIPATH_FLOW = 0,
+            MULTIPATH_PACKET = 1
+        } multipathMode_t;
+
+
         static TypeId GetTypeId();
 
 
@@ -150,21 +198,225 @@ namespace ns3
         void PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit = Time::S) const;
 
 
+        /**
+         * @brief Add a Network Route, an existing Route to the same Prefix is replaced
+         * 
+         * @param network   Destination Network
+         * @param netmask   Network Mask (contiguous)
+         * @param nexthop   Gateway
+         * @param interface Output Interface
+         */
         void AddRoutingEntry(Ipv4Address network, Ipv4Mask netmask, Ipv4Address nexthop, uint32_t interface);
 
-        typedef std::list<std::pair<Ipv4RoutingTableEntry*, uint32_t>> NetworkRoutes;
+        /**
+         * @brief Add an equal-cost Next Hop to a Prefix, the Route is created if missing
+         * 
+         * @param network   Destination Network
+         * @param netmask   Network Mask (contiguous)
+         * @param nexthop   Gateway, ignored if already a Next Hop of the Prefix
+         * @param interface Output Interface
+         */
+        void AddMultipathEntry(Ipv4Address network, Ipv4Mask netmask, Ipv4Address nexthop, uint32_t interface);
+
+        /**
+         * @brief Remove the Route to a Prefix
+         * 
+         * @param network   Destination Network
+         * @param netmask   Network Mask (contiguous)
+         * @return true     if a Route was removed
+         */
+        bool RemoveRoutingEntry(Ipv4Address network, Ipv4Mask netmask);
+
+        /**
+         * @brief Remove all Routes, the Storage is kept for the next Bulk Install
+         */
+        void ClearRoutingEntries();
+
+        /**
+         * @brief Get the Number of Routes
+         * 
+         * @return size_t 
+         */
+        size_t GetNRoutes() const;
+
+
+        /**
+         * @brief Set the +Grid of the ROUTING_GRID Mode
+         * 
+         * @param phasing       Phase Shift between neighbouring Planes in Degree
+         * @param closedSeam    Cross-Plane Links between the last and the first Plane (Walker-Delta)
+         * @param base          Address of Satellite ID zero, the ISL Address of a Satellite is base + ID
+         * @param icm           ICM with the current Cross-Plane Links, the global one if not set
+         */
+        void SetGrid(const double phasing, const bool closedSeam, const Ipv4Address base, Ptr<SatISLInterconTable> icm = nullptr);
+
+        /**
+         * @brief Set the Path Computation of the ROUTING_SOURCE Mode
+         * 
+         * @param path      e.g. SatISLGlobalRouting::GetPath, a null Callback disables the Source Routes
+         */
+        void SetPathCallback(PathCallback path);
+
 
     protected:
 
-        Ptr<Ipv4> m_ipv4;
+        void DoDispose() override;
 
-        NetworkRoutes m_routes;
+        Ptr<Ipv4> m_ipv4;
 
-        Ptr<Ipv4Route> LookUp(Ipv4Address dst, Ptr<NetDevice> oif = nullptr);
+        /**
+         * @brief Longest-Prefix Match of a Destination
+         * 
+         *        The Route Object of an Entry is created on its first Hit and shared by all
+         *        later Packets, so a Lookup costs O(Prefix Length) without Allocation.
+         * 
+         * @param dst       Destination Address
+         * @param oif       Output Device the Route must use, nullptr for any
+         * @param flow      Flow Hash selecting among equal-cost Next Hops
+         * @return Ptr<Ipv4Route>   nullptr if no Route matches
+         */
+        Ptr<Ipv4Route> LookUp(Ipv4Address dst, Ptr<NetDevice> oif = nullptr, const uint32_t flow = 0);
 
 
     private:
 
+        typedef enum
+        {
+            GRID_FORE = 0,
+            GRID_AFT = 1,
+            GRID_WEST = 2,
+            GRID_EAST = 3
+        } gridDirection_t;
+
+        /**
+         * @brief Route to a Prefix with its cached, immutable Route Objects
+         */
+        typedef struct
+        {
+            std::vector<Ipv4RoutingTableEntry> entries;     //!< equal-cost Next Hops, the first one defines the Prefix
+            std::vector<Ptr<Ipv4Route>> routes;             //!< Route Object by Next Hop, nullptr until the first Hit
+        } RouteEntry;
+
+        /**
+         * @brief Node of the path-compressed binary Trie over the Prefixes
+         */
+        typedef struct
+        {
+            uint32_t prefix;                    //!< Prefix Bits (host Order, masked)
+            uint8_t length;                     //!< Prefix Length
+            uint32_t child[2];                  //!< Child by next Bit, zero if none (the Root is never a Child)
+            int32_t entry;                      //!< Route Index, negative if the Node only branches
+        } TrieNode;
+
+
+        static uint32_t _mask(const uint8_t length);
+
+        void _insert(const uint32_t prefix, const uint8_t length, const int32_t entry);
+
+        /**
+         * @brief Find the Node of an exact Prefix
+         * 
+         * @return uint32_t     Node Index, UINT32_MAX if the Prefix has no Node
+         */
+        uint32_t _find(const uint32_t prefix, const uint8_t length) const;
+
+        /**
+         * @brief Drop the cached Route Objects, e.g. after an Address Change
+         */
+        void _invalidate();
+
+        /**
+         * @brief Hash of the 5-Tuple, the Ports only if the Packet is not fragmented and starts with a TCP or UDP Header
+         * 
+         * @param p         Packet without IP Header, nullptr if the Ports are not known yet
+         */
+        uint32_t _flowHash(const Ipv4Header &header, Ptr<const Packet> p) const;
+
+        /**
+         * @brief Next Hop within the +Grid, O(1) per Packet
+         * 
+         * @return Ptr<Ipv4Route>   nullptr if the Destination is not in the Grid of this Node or the
+         *                          Cross-Plane Link is missing outside the Polar Region
+         */
+        Ptr<Ipv4Route> _gridLookUp(Ipv4Address dst);
+
+        /**
+         * @brief Resolve the own Coordinates and Neighbours once
+         */
+        bool _gridResolve();
+
+        /**
+         * @brief Get the (Plane, Slot) Coordinates of a Satellite in the Constellation of this Node
+         */
+        bool _gridCoordinates(const satid_t id, uint32_t &plane, uint32_t &slot) const;
+
+        /**
+         * @brief Mean Anomaly of a Slot at Epoch in Slots (Phases as set by the WalkerConstellationHelper)
+         */
+        double _gridPhase(const uint32_t plane, const uint32_t slot) const;
+
+        /**
+         * @brief Check if a Position is above the PolarLatitude
+         */
+        bool _gridPolar(const Vector &pos) const;
+
+        Ptr<Ipv4Route> _gridRoute(const gridDirection_t direction);
+
+        /**
+         * @brief Compute the Source Route at the Ingress
+         * 
+         * @param dst       Destination Address
+         * @param ttl       TTL of the Packet on Arrival at the first Hop
+         * @param tag       Tag with the Hop List for the Packet, set if a Route is returned
+         * @return Ptr<Ipv4Route>   Route to the first Hop, nullptr if no Path is known
+         */
+        Ptr<Ipv4Route> _sourceRoute(Ipv4Address dst, uint8_t ttl, ISLSourceRouteTag &tag);
+
+        /**
+         * @brief Get the Route to a Neighbour over the ISL Interface
+         * 
+         *        Routes are cached by Gateway, the Scan is bounded by the Number of Neighbours.
+         */
+        Ptr<Ipv4Route> _hopRoute(Ipv4Address gateway);
+
+        /**
+         * @brief Get the ISL Interface, resolved once
+         * 
+         * @return int32_t  negative if the Node has no ISL Device
+         */
+        int32_t _getISLInterface();
+
+
+        std::vector<RouteEntry> m_routes;       //!< Routes by Index
+        std::vector<TrieNode> m_trie;           //!< Trie Nodes, Root at Index zero
+
+        routingMode_t m_mode;                   //!< Forwarding Mode
+        multipathMode_t m_multipath;            //!< Selection among equal-cost Next Hops
+        uint32_t m_spray;                       //!< Packet Counter of the MULTIPATH_PACKET Mode
+        uint64_t m_hashSalt;                    //!< Node-specific Salt, decorrelates the Choices along a Path
+        double m_gridPhasing;                   //!< Phase Shift between neighbouring Planes in Degree
+        double m_gridPolarLatitude;             //!< Latitude of the Polar Shutdown in Degree
+        bool m_gridClosedSeam;                  //!< Cross-Plane Links across the Seam
+        Ipv4Address m_gridBase;                 //!< Address of Satellite ID zero
+        Ptr<SatISLInterconTable> m_gridIcm;     //!< ICM with the current Cross-Plane Links
+
+        bool m_gridResolved;                    //!< Own Coordinates resolved
+        satid_t m_gridId;                       //!< Own Satellite ID
+        cstid_t m_gridCID;                      //!< Own Constellation
+        uint32_t m_gridPlane;                   //!< Own Plane
+        uint32_t m_gridSlot;                    //!< Own Slot
+        uint32_t m_gridPlanes;                  //!< Number of Planes
+        uint32_t m_gridSats;                    //!< Satellites per Plane
+        Ptr<MobilityModel> m_gridMobility;      //!< Own Position for the Polar Detour
+        satid_t m_gridNeighbours[4];            //!< Neighbour by Direction, zero if none
+        Ptr<Ipv4Route> m_gridRoutes[4];         //!< Route by Direction, created on first Use
+
+        PathCallback m_path;                    //!< Path Computation of the Source Routes
+        std::vector<Ipv4Address> m_pathBuffer;  //!< Reused Hop List of the Ingress
+        std::vector<Ptr<Ipv4Route>> m_hopRoutes;    //!< Routes to the Neighbours by Gateway
+
+        int32_t m_islInterface;                 //!< ISL Interface, negative until resolved
+
     }; /* SatelliteISLRoutingIPv4 */
 
 
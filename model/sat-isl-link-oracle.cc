@@ -0,0 +1,211 @@
+/**
+ * @brief   Time-stepped Link-State Oracle for Inter-Satellite-Links
+ *
+ * @file    sat-isl-link-oracle.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-isl-link-oracle.h"
+#include "sat-isl-channel.h"
+#include "sat-isl-net-device.h"
+
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/mobility-model.h"
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatelliteISLLinkOracle");
+    NS_OBJECT_ENSURE_REGISTERED(SatelliteISLLinkOracle);
+
+
+    TypeId SatelliteISLLinkOracle::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatelliteISLLinkOracle")
+            .SetParent<Object>()
+            .AddConstructor<SatelliteISLLinkOracle>()
+            .AddAttribute(
+                "UpdateInterval"
+                , "Interval to re-evaluate all registered Links, zero evaluates on every query"
+                , TimeValue(MilliSeconds(10))
+                , MakeTimeAccessor(&SatelliteISLLinkOracle::SetUpdateInterval, &SatelliteISLLinkOracle::GetUpdateInterval)
+                , MakeTimeChecker(Time(0))
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatelliteISLLinkOracle::SatelliteISLLinkOracle()
+    : m_channel(nullptr)
+    , m_interval(MilliSeconds(10))
+    {
+    }
+
+
+    SatelliteISLLinkOracle::~SatelliteISLLinkOracle()
+    {
+    }
+
+
+    void SatelliteISLLinkOracle::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        Clear();
+        m_channel = nullptr;
+
+        Object::DoDispose();
+    }
+
+
+    void SatelliteISLLinkOracle::SetChannel(Ptr<SatelliteISLChannel> channel)
+    {
+        NS_LOG_FUNCTION(this << channel);
+        m_channel = channel;
+    }
+
+
+    void SatelliteISLLinkOracle::SetUpdateInterval(const Time interval)
+    {
+        NS_LOG_FUNCTION(this << interval);
+        m_interval = interval;
+
+        m_updateEvent.Cancel();
+        if (m_interval.IsStrictlyPositive() && !m_links.empty())
+        {
+            m_updateEvent = Simulator::Schedule(m_interval, &SatelliteISLLinkOracle::Update, this);
+        }
+    }
+
+
+    Time SatelliteISLLinkOracle::GetUpdateInterval() const
+    {
+        return m_interval;
+    }
+
+
+    size_t SatelliteISLLinkOracle::GetNLinks() const
+    {
+        return m_links.size();
+    }
+
+
+    const SatelliteISLLinkOracle::LinkState& SatelliteISLLinkOracle::GetLinkState(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx)
+    {
+        uint64_t key = _linkKey(tx, rx);
+
+        auto link = m_links.find(key);
+        if (link == m_links.end())
+        {
+            LinkState state;
+            state.tx = tx;
+            state.rx = rx;
+
+            link = m_links.insert(std::pair{key, state}).first;
+            Evaluate(link->second);
+        }
+        else if ((Simulator::Now() - link->second.stamp >= m_interval) && (link->second.stamp != Simulator::Now()))
+        {
+            // Exact Mode (zero Interval) or no periodic Update running
+            Evaluate(link->second);
+        }
+
+        // Keep the periodic Update alive only while Links are queried
+        link->second.queried = true;
+        if (m_interval.IsStrictlyPositive() && !m_updateEvent.IsRunning())
+        {
+            m_updateEvent = Simulator::Schedule(m_interval, &SatelliteISLLinkOracle::Update, this);
+        }
+
+        return link->second;
+    }
+
+
+    void SatelliteISLLinkOracle::Update()
+    {
+        NS_LOG_FUNCTION(this << m_links.size());
+
+        for (auto link = m_links.begin(); link != m_links.end(); )
+        {
+            LinkState &state = link->second;
+
+            if (!state.queried)
+            {
+                link = m_links.erase(link);
+                continue;
+            }
+
+            state.queried = false;
+            Evaluate(state);
+            link++;
+        }
+
+        if (m_interval.IsStrictlyPositive() && !m_links.empty() && !m_updateEvent.IsRunning())
+        {
+            m_updateEvent = Simulator::Schedule(m_interval, &SatelliteISLLinkOracle::Update, this);
+        }
+    }
+
+
+    void SatelliteISLLinkOracle::Clear()
+    {
+        NS_LOG_FUNCTION(this);
+        m_updateEvent.Cancel();
+        m_links.clear();
+    }
+
+
+    void SatelliteISLLinkOracle::Evaluate(LinkState &state) const
+    {
+        Ptr<MobilityModel> tx_mob = state.tx->GetNode()->GetObject<MobilityModel>();
+        Ptr<MobilityModel> rx_mob = state.rx->GetNode()->GetObject<MobilityModel>();
+
+        // Terminal Angles are relative to the Local Reference of the Transmitter
+        state.tx->GetLocalReference()->UpdateLocalReference(tx_mob);
+
+        size_t N = state.tx->GetNTerminals();
+        state.rates.assign(N, DataRate(0));
+        state.rate = DataRate(0);
+        state.terminal = 0;
+
+        for (size_t n = 0; n < N; n++)
+        {
+            DataRate rate = state.tx->GetISLTerminal(n)->GetRateEstimation(tx_mob, rx_mob, m_channel->GetPropagationLossModel(), m_channel->GetNoiseTemperature());
+            state.rates[n] = rate;
+
+            if (rate > state.rate)
+            {
+                state.rate = rate;
+                state.terminal = n;
+            }
+        }
+
+        state.feasible = (state.rate > 0) && (state.rate >= state.tx->GetMinDR());
+
+        Ptr<PropagationDelayModel> delay = m_channel->GetPropagationDelayModel();
+        state.delay = (delay != nullptr) ? delay->GetDelay(tx_mob, rx_mob) : Time(0);
+        state.stamp = Simulator::Now();
+    }
+
+
+    uint64_t SatelliteISLLinkOracle::_linkKey(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx) const
+    {
+        size_t tx_index = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(tx->GetAddress()));
+        size_t rx_index = m_channel->GetDeviceIndex(Mac48Address::ConvertFrom(rx->GetAddress()));
+        NS_ASSERT_MSG(tx_index != SatelliteISLChannel::NO_DEVICE && rx_index != SatelliteISLChannel::NO_DEVICE, "Device not attached to the Channel");
+
+        return ((uint64_t) tx_index << 32) | rx_index;
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,157 @@
+/**
+ * @brief   Time-stepped Link-State Oracle for Inter-Satellite-Links
+ *
+ * @file    sat-isl-link-oracle.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ISL_LINK_ORACLE_H
+#define SATELLITE_ISL_LINK_ORACLE_H
+
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/data-rate.h"
+
+#include <unordered_map>
+#include <vector>
+
+
+namespace ns3
+{
+
+class SatelliteISLChannel;
+class SatelliteISLNetDevice;
+
+
+/**
+ * \ingroup satellite
+ *
+ * The Oracle caches the Link-State (rate per Terminal, propagation delay, best Terminal
+ * and feasibility) of every (tx, rx) Device pair that was queried on its Channel. All
+ * registered pairs are re-evaluated once per Update Interval, so Devices read the physics
+ * in O(1) instead of recomputing it for every Packet. Pairs not queried since the last
+ * Update are dropped, so the periodic Update pauses while no Link is queried.
+ *
+ * A Device sleeping on an infeasible Link is not polled by the Oracle: it stops querying
+ * the Link and wakes itself at the predicted Availability (PredictLinkAvailability).
+ *
+ * The Update Interval is the accuracy knob: an Interval of zero evaluates the Link on
+ * every query, larger Intervals trade Accuracy for Speed.
+ *
+ * \brief Shared Link-State Oracle of a SatelliteISLChannel
+ */
+class SatelliteISLLinkOracle : public Object
+{
+public:
+
+    /**
+     * @brief Cached State of a directed Link
+     */
+    typedef struct
+    {
+        Ptr<SatelliteISLNetDevice> tx;      //!< Transmitting Device
+        Ptr<SatelliteISLNetDevice> rx;      //!< Receiving Device
+        bool feasible;                      //!< Best Rate reaches the MinDR of the Transmitter
+        DataRate rate;                      //!< Best Rate over all Terminals
+        size_t terminal;                    //!< Index of the Terminal with the best Rate
+        std::vector<DataRate> rates;        //!< Rate by Terminal Index of the Transmitter
+        Time delay;                         //!< Propagation Delay
+        Time stamp;                         //!< Time of the last Evaluation
+        bool queried;                       //!< Queried since the last Update
+    } LinkState;
+
+
+    static TypeId GetTypeId();
+
+    SatelliteISLLinkOracle();
+    ~SatelliteISLLinkOracle();
+
+
+    /**
+     * @brief Set the Channel providing the Loss-, Delay- and Noise-Models
+     *
+     * @param channel
+     */
+    void SetChannel(Ptr<SatelliteISLChannel> channel);
+
+
+    /**
+     * @brief Get the Link-State of a directed Link
+     *
+     *        Unknown pairs are evaluated immediately and registered for the
+     *        periodic Update.
+     *
+     * @param tx    Transmitting Device
+     * @param rx    Receiving Device
+     * @return const LinkState&
+     */
+    const LinkState& GetLinkState(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx);
+
+
+    /**
+     * @brief Re-evaluate all registered Links, Links not queried since the last Update are dropped
+     */
+    void Update();
+
+
+    /**
+     * @brief Remove all registered Links
+     */
+    void Clear();
+
+
+    void SetUpdateInterval(const Time interval);
+    Time GetUpdateInterval() const;
+
+
+    /**
+     * @brief Get the Number of registered Links
+     *
+     * @return size_t
+     */
+    size_t GetNLinks() const;
+
+
+protected:
+
+    void DoDispose() override;
+
+
+private:
+
+    /**
+     * @brief Evaluate the Physics of a single Link
+     *
+     * @param state     Link to evaluate
+     */
+    void Evaluate(LinkState &state) const;
+
+
+    /**
+     * @brief Key of a Link by the Channel Indices of its Devices (a Node may have several ISL Devices)
+     */
+    uint64_t _linkKey(Ptr<SatelliteISLNetDevice> tx, Ptr<SatelliteISLNetDevice> rx) const;
+
+
+    Ptr<SatelliteISLChannel> m_channel;
+
+    Time m_interval;                                                //!< Update Interval
+    EventId m_updateEvent;                                          //!< Next periodic Update
+
+    std::unordered_map<uint64_t, LinkState> m_links;                //!< Links by (tx, rx) Channel Index
+
+};  /* SatelliteISLLinkOracle */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_LINK_ORACLE_H */
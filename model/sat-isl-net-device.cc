@@ -13,7 +13,10 @@
 
 #include "sat-isl-net-device.h"
 #include "sat-isl-channel.h"
+#include "sat-isl-link-oracle.h"
 #include "sat-isl-pck-tag.h"
+#include "sat-isl-intercon-table.h"
+#include "ns3/sat-node-tag.h"
 
 #include "ns3/simulator.h"
 #include "ns3/pointer.h"
@@ -21,9 +24,11 @@
 #include "ns3/error-model.h"
 #include "ns3/log.h"
 #include "ns3/queue.h"
+#include "ns3/drop-tail-queue.h"
 #include "ns3/boolean.h"
 #include "ns3/string.h"
 #include "ns3/double.h"
+#include "ns3/nstime.h"
 #include "ns3/trace-source-accessor.h"
 
 #include "ns3/mobility-model.h"
@@ -49,11 +54,11 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
                 MakePointerChecker<ErrorModel>()
             )
             .AddAttribute(
-                "TxQueue",
-                "NetDevice Transmit Queue",
-                StringValue("ns3::DropTailQueue<Packet>"),
-                MakePointerAccessor(&SatelliteISLNetDevice::m_queue),
-                MakePointerChecker<Queue<Packet>>()
+                "TxQueueMaxSize",
+                "Max. Size of each per Next-Hop Virtual Output Queue",
+                QueueSizeValue(QueueSize("100p")),
+                MakeQueueSizeAccessor(&SatelliteISLNetDevice::m_queueMaxSize),
+                MakeQueueSizeChecker()
             )
             .AddAttribute(
                 "ATPDelay",
@@ -83,6 +88,20 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
                 MakeDoubleAccessor(&SatelliteISLNetDevice::SetRxSensitivity, &SatelliteISLNetDevice::GetRxSensitivity),
                 MakeDoubleChecker<double>(0.0)
             )
+            .AddAttribute(
+                "MinWakeInterval",
+                "Lower Bound of the Delay until a Transmission to an unreachable Destination is retried",
+                TimeValue(MilliSeconds(1)),
+                MakeTimeAccessor(&SatelliteISLNetDevice::m_minWake),
+                MakeTimeChecker(Time(0))
+            )
+            .AddAttribute(
+                "MaxWakeInterval",
+                "Upper Bound of the Delay until a Transmission to an unreachable Destination is retried",
+                TimeValue(Seconds(10)),
+                MakeTimeAccessor(&SatelliteISLNetDevice::m_maxWake),
+                MakeTimeChecker(Time(0))
+            )
             .AddAttribute(
                 "GlobalICM",
                 "Use Global Interconnect Matrix (ICM) for Known Neighbours",
@@ -102,6 +121,18 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
                 MakeTraceSourceAccessor(&SatelliteISLNetDevice::m_phyRxTrace),
                 "ns3::Packet::TracedCallback"
             )
+            .AddTraceSource(
+                "PhyRxSignal",
+                "Trace Source to indicate Signal Reception (fc, AoA/AoD, SNR, Rate) at the Device",
+                MakeTraceSourceAccessor(&SatelliteISLNetDevice::m_phyRxSignalTrace),
+                "ns3::SatelliteISLSignal::TracedCallback"
+            )
+            .AddTraceSource(
+                "MacTxDrop",
+                "Trace Source to indicate a Packet dropped before Transmission",
+                MakeTraceSourceAccessor(&SatelliteISLNetDevice::m_macTxDropTrace),
+                "ns3::Packet::TracedCallback"
+            )
         ;
 
 
@@ -117,6 +148,22 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
     {
         NS_LOG_FUNCTION(this);
         m_refLVLH = CreateObject<LVLHReference>();
+        m_queueFactory.SetTypeId("ns3::DropTailQueue<Packet>");
+    }
+
+
+    static uint64_t _addrToKey(const Mac48Address addr)
+    {
+        uint64_t key = 0;
+        addr.CopyTo((uint8_t*) &key);
+        return key;
+    }
+
+
+    void SatelliteISLNetDevice::ReceiveSignal(SatelliteISLSignal signal)
+    {
+        m_phyRxSignalTrace(signal);
+        Receive(signal.GetPacket(), signal.protocol, signal.dst, signal.src);
     }
 
 
@@ -179,17 +226,35 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
     }
 
 
-    void SatelliteISLNetDevice::SetQueue(Ptr<Queue<Packet>> queue)
+    void SatelliteISLNetDevice::SetQueueFactory(ObjectFactory factory)
     {
-        NS_LOG_FUNCTION(this << queue);
-        m_queue = queue;
+        NS_LOG_FUNCTION(this);
+        m_queueFactory = factory;
     }
 
 
-    Ptr<Queue<Packet>> SatelliteISLNetDevice::GetQueue() const
+    Ptr<Queue<Packet>> SatelliteISLNetDevice::GetQueue(Mac48Address nextHop) const
     {
-        NS_LOG_FUNCTION(this);
-        return m_queue;
+        NS_LOG_FUNCTION(this << nextHop);
+
+        if (auto voq = m_voqs.find(_addrToKey(nextHop)); voq != m_voqs.end())
+        {
+            return voq->second.queue;
+        }
+
+        return nullptr;
+    }
+
+
+    uint32_t SatelliteISLNetDevice::GetNQueuedPackets() const
+    {
+        uint32_t n = 0;
+        for (const auto &voq : m_voqs)
+        {
+            n += voq.second.queue->GetNPackets();
+        }
+
+        return n;
     }
 
 
@@ -365,7 +430,7 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
         }
         
 
-        if (m_queue->GetNPackets() >= 1 && !m_finishTransmissionEvent.IsRunning())
+        if (!m_voqActive.empty())
         {
             StartTransmission();
         }
@@ -377,21 +442,35 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
 
     bool SatelliteISLNetDevice::EnqueueBroadcast(Ptr<Packet> pck, Mac48Address src, Mac48Address dst, uint16_t proto)
     {
-        for(auto it = m_channel->GetDevicesBegin(); it != m_channel->GetDevicesEnd(); it++)
+        // Limit the Fan-Out to Devices in Range, if the Channel defines one
+        std::vector<Ptr<SatelliteISLNetDevice>> others;
+        double range = m_channel->GetBroadcastRange();
+
+        if (range > 0.0)
+        {
+            others = m_channel->GetDevicesInRange(GetNode()->GetObject<MobilityModel>()->GetPosition(), range);
+        }
+        else
+        {
+            others.assign(m_channel->GetDevicesBegin(), m_channel->GetDevicesEnd());
+        }
+
+        for (Ptr<NetDevice> other : others)
         {
-            Ptr<NetDevice> other = it->second;
             if (other == this) continue;
 
+            Mac48Address other_addr = Mac48Address::ConvertFrom(other->GetAddress());
+
             ISLPacketTag tag;
             tag.SetSrc(src);
             tag.SetDst(dst);
             tag.SetProto(proto);
-            tag.SetSilentDst(Mac48Address::ConvertFrom(other->GetAddress()));
+            tag.SetSilentDst(other_addr);
 
             Ptr<Packet> cpy = pck->Copy();
             cpy->AddPacketTag(tag);
 
-            m_queue->Enqueue(cpy);
+            EnqueueVoq(other_addr, cpy);
         }
         return true;
     }
@@ -407,96 +486,228 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
 
         NS_LOG_FUNCTION(this << src << dst);
 
-        return m_queue->Enqueue(pck);
+        return EnqueueVoq(dst, pck);
     }
 
 
-    void SatelliteISLNetDevice::StartTransmission()
+    bool SatelliteISLNetDevice::EnqueueVoq(Mac48Address nextHop, Ptr<Packet> pck)
     {
-        if (m_queue->GetNPackets() == 0)
+        uint64_t key = _addrToKey(nextHop);
+        auto voq = m_voqs.find(key);
+
+        if (voq == m_voqs.end())
         {
-            return;
+            Ptr<NetDevice> other = m_channel->GetDevice(nextHop);
+            if (other == nullptr)
+            {
+                NS_LOG_FUNCTION(this << "Critical Error - Target Device not found!");
+                m_macTxDropTrace(pck);
+                return false;
+            }
+
+            VirtualOutputQueue entry;
+            entry.device = StaticCast<SatelliteISLNetDevice>(other);
+            entry.queue = m_queueFactory.Create<Queue<Packet>>();
+            entry.queue->SetMaxSize(m_queueMaxSize);
+
+            voq = m_voqs.insert(std::pair{key, entry}).first;
         }
 
-        NS_ASSERT_MSG(!m_finishTransmissionEvent.IsRunning(), "Transmission already in Progress!");
-        
-        
-        // Deque Package
-        Ptr<Packet> pck = m_queue->Dequeue();
+        bool was_empty = voq->second.queue->IsEmpty();
 
-        ISLPacketTag tag;
-        if (!pck->PeekPacketTag(tag))
+        if (!voq->second.queue->Enqueue(pck))
         {
-            NS_LOG_FUNCTION(this << "Critical Error - No Pck Tag assigned!");
-            Simulator::Schedule(MilliSeconds(100), &SatelliteISLNetDevice::StartTransmission, this);
-            return;
+            return false;
         }
 
-        Time block_time = Time(0);
+        // Queue becomes eligible for Scheduling, unless it waits for its Link
+        if (was_empty && !voq->second.wakeEvent.IsRunning())
+        {
+            m_voqActive.push_back(key);
+        }
 
-        // Get Other MobilityModel
-        Ptr<NetDevice> other = nullptr;
+        return true;
+    }
 
-        NS_LOG_FUNCTION(this << tag.GetDst() << tag.GetSilentDst());
 
-        if (tag.GetDst().IsBroadcast())
+    void SatelliteISLNetDevice::StartTransmission()
+    {
+        if (m_voqActive.empty() || !HasIdleTerminal())
         {
-            other = m_channel->GetDevice(tag.GetSilentDst());
+            return;
         }
-        else
+
+        // Work-conserving Round-Robin over all VOQs, one Packet per VOQ and Round.
+        // Unreachable Next-Hops are put to sleep, VOQs reachable only by busy Terminals wait.
+        bool progress = true;
+        while (progress && !m_voqActive.empty() && HasIdleTerminal())
         {
-            other = m_channel->GetDevice(tag.GetDst());
+            progress = false;
+
+            for (size_t n = m_voqActive.size(); n > 0 && HasIdleTerminal(); n--)
+            {
+                uint64_t key = m_voqActive.front();
+                m_voqActive.pop_front();
+
+                VirtualOutputQueue &voq = m_voqs.at(key);
+                if (voq.queue->IsEmpty()) continue;
+
+                Ptr<SatelliteISLNetDevice> other = voq.device;
+
+                // Rates of all Terminals from the shared Link-State Oracle
+                const SatelliteISLLinkOracle::LinkState &link = m_channel->GetLinkState(this, other);
+
+                DataRate rate(0);
+                Ptr<SatelliteISLTerminal> term;
+
+                for (size_t t = 0; t < m_terminals.size(); t++)
+                {
+                    DataRate new_rate = link.rates[t];
+                    if ((new_rate > 0) && (new_rate >= m_minDR) && !m_terminals[t]->IsBusy() && (new_rate > rate))
+                    {
+                        term = m_terminals[t];
+                        rate = new_rate;
+                    }
+                }
+
+                Time wake;
+                if (link.feasible && !IsKnownNeighbour(other, wake))
+                {
+                    // Not listed in the current ICM Epoch, retry with the next one
+                    NS_LOG_FUNCTION(this << "Target Device not in ICM - Wake-Up in " << wake.As(Time::MS));
+                    voq.wakeEvent = Simulator::Schedule(wake, &SatelliteISLNetDevice::WakeVoq, this, key);
+                    continue;
+                }
+
+                if (!link.feasible)
+                {
+                    // Sleep until the Link can become feasible, a Topology Change notifies earlier
+                    wake = PredictLinkAvailability(other);
+                    NS_LOG_FUNCTION(this << "Target Device not reachable - Wake-Up in " << wake.As(Time::MS));
+                    voq.wakeEvent = Simulator::Schedule(wake, &SatelliteISLNetDevice::WakeVoq, this, key);
+                    continue;
+                }
+
+                if (term == nullptr)
+                {
+                    // All Terminals reaching the Next-Hop are busy, retry on their completion
+                    m_voqActive.push_back(key);
+                    continue;
+                }
+
+                Ptr<Packet> pck = voq.queue->Dequeue();
+                if (!voq.queue->IsEmpty())
+                {
+                    m_voqActive.push_back(key);
+                }
+
+                if (term->Transmit(pck, this, other, m_channel, rate).IsZero())
+                {
+                    NS_LOG_FUNCTION(this << "Critical Error - Transmission failed!");
+                    m_macTxDropTrace(pck);
+                }
+
+                progress = true;
+            }
         }
+    }
 
-        if (other == nullptr)
+
+    bool SatelliteISLNetDevice::HasIdleTerminal() const
+    {
+        for (const auto& terminal : m_terminals)
         {
-            NS_LOG_FUNCTION(this << "Critical Error - Target Device not found!");
-            Simulator::Schedule(MilliSeconds(100), &SatelliteISLNetDevice::StartTransmission, this);
-            return;
+            if (!terminal->IsBusy()) return true;
         }
-        
-        // Update Local Reference Frame
+
+        return false;
+    }
+
+
+    Time SatelliteISLNetDevice::PredictLinkAvailability(Ptr<NetDevice> other) const
+    {
         Ptr<MobilityModel> mob = m_node->GetObject<MobilityModel>();
-        m_refLVLH->UpdateLocalReference(mob->GetPosition(), mob->GetVelocity());
+        Ptr<MobilityModel> other_mob = other->GetNode()->GetObject<MobilityModel>();
 
-        DataRate rate(0);
-        Ptr<SatelliteISLTerminal> term;
+        // Update Local Reference Frame
+        m_refLVLH->UpdateLocalReference(mob);
 
+        Time wake = Time::Max();
         for (const auto& terminal : m_terminals)
         {
-            DataRate new_rate = terminal->GetRateEstimation(mob, other->GetNode()->GetObject<MobilityModel>(), m_channel->GetPropagationLossModel(), m_channel->GetNoiseTemperature());
-            if ((new_rate > 0) && (new_rate > rate))
-            {
-                term = terminal;
-                rate = new_rate;
-            } 
-                
+            Time est = terminal->EstimateTimeToLink(mob, other_mob, m_channel->GetPropagationLossModel(), m_channel->GetNoiseTemperature(), m_minDR);
+            wake = std::min(wake, est);
         }
 
-        if ((rate < m_minDR) || (term == nullptr))
-        {
-            NS_LOG_FUNCTION(this << "Critical Error - Target Device not reachable!");
-            Simulator::Schedule(MilliSeconds(1), &SatelliteISLNetDevice::StartTransmission, this);
-            return;
-        }
+        return std::min(std::max(wake, m_minWake), m_maxWake);
+    }
+
+
+    bool SatelliteISLNetDevice::IsKnownNeighbour(Ptr<NetDevice> other, Time &wake) const
+    {
+        if (!m_useICM) return true;
+
+        Ptr<SatelliteNodeTag> tag = m_node->GetObject<SatelliteNodeTag>();
+        Ptr<SatelliteNodeTag> other_tag = other->GetNode()->GetObject<SatelliteNodeTag>();
+        if (tag == nullptr || other_tag == nullptr) return true;
+
+        Ptr<SatISLInterconTable> icm = SatISLInterconTable::Get();
+        Time now = Simulator::Now();
+
+        if (icm->IsAvailable(tag->GetId(), other_tag->GetId(), now)) return true;
+
+        Time next = icm->GetNextChange(now);
+        wake = (next == Time::Max()) ? m_maxWake : std::min(std::max(next - now, m_minWake), m_maxWake);
 
+        return false;
+    }
 
-        block_time = term->Transmit(pck, this, other, m_channel);
 
-        // }
+    void SatelliteISLNetDevice::WakeVoq(uint64_t key)
+    {
+        NS_LOG_FUNCTION(this << key);
 
-        //DataRate rate = DataRate("1Mb/s");
-        //Time txTime = rate.CalculateBytesTxTime(pck->GetSize());
+        auto voq = m_voqs.find(key);
+        if (voq == m_voqs.end() || voq->second.queue->IsEmpty()) return;
 
-        //NS_LOG_UNCOND(this << "  block: " << block_time.GetMicroSeconds());
+        voq->second.wakeEvent.Cancel();
+        m_voqActive.push_back(key);
 
-        m_finishTransmissionEvent = Simulator::Schedule(block_time, &SatelliteISLNetDevice::FinishTransmission, this, pck);
+        StartTransmission();
     }
 
 
-    void SatelliteISLNetDevice::FinishTransmission(Ptr<Packet> pck)
+    void SatelliteISLNetDevice::NotifyLinkChange()
     {
         NS_LOG_FUNCTION(this);
+
+        for (auto &voq : m_voqs)
+        {
+            if (voq.second.wakeEvent.IsRunning())
+            {
+                voq.second.wakeEvent.Cancel();
+                m_voqActive.push_back(voq.first);
+            }
+        }
+
+        StartTransmission();
+    }
+
+
+    void SatelliteISLNetDevice::NotifyLinkChange(Mac48Address nextHop)
+    {
+        NS_LOG_FUNCTION(this << nextHop);
+
+        auto voq = m_voqs.find(_addrToKey(nextHop));
+        if (voq == m_voqs.end() || !voq->second.wakeEvent.IsRunning()) return;
+
+        WakeVoq(voq->first);
+    }
+
+
+    void SatelliteISLNetDevice::FinishTransmission(Ptr<SatelliteISLTerminal> terminal, Ptr<Packet> pck)
+    {
+        NS_LOG_FUNCTION(this << terminal);
         StartTransmission();
     }
 
@@ -539,11 +750,19 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
         m_channel = nullptr;
         m_node = nullptr;
         m_recErrModel = nullptr;
-        m_queue->Dispose();
-        
-        /** 
-         * \todo Finish Transmission Event
-        */
+
+        for (auto &terminal : m_terminals)
+        {
+            terminal->Dispose();
+        }
+
+        for (auto &voq : m_voqs)
+        {
+            voq.second.wakeEvent.Cancel();
+            voq.second.queue->Dispose();
+        }
+        m_voqs.clear();
+        m_voqActive.clear();
 
         NetDevice::DoDispose();
     }
@@ -574,6 +793,7 @@ NS_LOG_COMPONENT_DEFINE("SatelliteISLNetDevice");
         NS_LOG_FUNCTION(this << terminal);
         
         terminal->SetLocalReference(m_refLVLH);
+        terminal->SetTxCompleteCallback(MakeCallback(&SatelliteISLNetDevice::FinishTransmission, this));
         m_terminals.insert(m_terminals.end(), terminal);
 
     }
@@ -21,13 +21,19 @@
 #include "ns3/data-rate.h"
 #include "ns3/event-id.h"
 #include "ns3/net-device.h"
+#include "ns3/object-factory.h"
 #include "ns3/queue-fwd.h"
+#include "ns3/queue-size.h"
 #include "ns3/traced-callback.h"
 
+#include "sat-isl-signal.h"
+
 #include "ns3/sat-isl-terminal.h"
 
 #include <stdint.h>
 #include <string>
+#include <deque>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -52,7 +58,13 @@ public:
 
 
 
-    //void ReceiveSignal(Ptr<SatelliteISLSignal> signal, Mac48Address to, Mac48Address from);
+    /**
+     * Receive a Signal from a connected ISL Channel, the Signal is
+     * traced and its Packet is passed on to Receive
+     *
+     * \param signal Signal Descriptor of the Transmission
+     */
+    void ReceiveSignal(SatelliteISLSignal signal);
 
     /**
      * Receive a packet from a connected ISL Channel. The
@@ -78,19 +90,28 @@ public:
 
 
     /**
-     * Attach a queue to the SimpleNetDevice.
+     * Set the Factory used to create the Virtual Output Queues.
      *
-     * \param queue Ptr to the new queue.
+     * \param factory Queue Factory, e.g. for ns3::DropTailQueue<Packet>
      */
-    void SetQueue(Ptr<Queue<Packet>> queue);
+    void SetQueueFactory(ObjectFactory factory);
 
 
     /**
-     * Get a copy of the attached Queue.
+     * Get the Virtual Output Queue of a Next-Hop.
      *
-     * \returns Ptr to the queue.
+     * \param nextHop Address of the Next-Hop Device
+     * \returns Ptr to the queue, nullptr if nothing was queued for this Next-Hop yet.
      */
-    Ptr<Queue<Packet>> GetQueue() const;
+    Ptr<Queue<Packet>> GetQueue(Mac48Address nextHop) const;
+
+
+    /**
+     * Get the Number of Packets over all Virtual Output Queues.
+     *
+     * \returns Number of queued Packets
+     */
+    uint32_t GetNQueuedPackets() const;
 
 
     /**
@@ -154,6 +175,23 @@ public:
     double GetRxSensitivity() const;
 
 
+    /**
+     * @brief Notify the Device about a changed Link State
+     * 
+     *        A Device waiting for an unreachable Destination is woken up
+     *        immediately instead of waiting for the predicted Wake-Up Time.
+     */
+    void NotifyLinkChange();
+
+
+    /**
+     * @brief Notify the Device about a changed Link State towards one Next-Hop
+     * 
+     * @param nextHop   Address of the Next-Hop Device
+     */
+    void NotifyLinkChange(Mac48Address nextHop);
+
+
     // inherited from NetDevice base class.
     void SetIfIndex(const uint32_t index) override;
     uint32_t GetIfIndex() const override;
@@ -220,19 +258,78 @@ protected:
 private:
 
     /**
-     * The StartTransmission method is used internally to start the process
-     * of sending a packet out on the channel, by scheduling the
-     * FinishTransmission method at a time corresponding to the transmission
-     * delay of the packet.
+     * @brief Virtual Output Queue holding the Packets for a single Next-Hop
+     */
+    typedef struct
+    {
+        Ptr<SatelliteISLNetDevice> device;  //!< Next-Hop Device
+        Ptr<Queue<Packet>> queue;       //!< Packets waiting for the Next-Hop
+        EventId wakeEvent;              //!< Wake-Up event while the Next-Hop is unreachable
+    } VirtualOutputQueue;
+
+
+    /**
+     * @brief Enqueue a Packet to the Virtual Output Queue of its Next-Hop
+     * 
+     * @param nextHop   Address of the Next-Hop Device
+     * @param pck       Tagged Packet
+     * @return true     if the Packet was queued
+     */
+    bool EnqueueVoq(Mac48Address nextHop, Ptr<Packet> pck);
+
+
+    /**
+     * @brief Reactivate a sleeping Virtual Output Queue
+     * 
+     * @param key       Hashed Next-Hop Address
+     */
+    void WakeVoq(uint64_t key);
+
+
+    /**
+     * The StartTransmission method is used internally to assign queued packets
+     * to idle Terminals. Each Terminal transmits independently and reports
+     * back through FinishTransmission once its packet is on the channel.
      */
     void StartTransmission();
 
     /**
      * The FinishTransmission method is used internally to finish the process
-     * of sending a packet out on the channel.
-     * \param packet The packet to send on the channel
+     * of sending a packet out on the channel and to refill the idle Terminal.
+     * \param terminal The Terminal that completed the transmission
+     * \param packet The packet sent on the channel
+     */
+    void FinishTransmission(Ptr<SatelliteISLTerminal> terminal, Ptr<Packet> packet);
+
+
+    /**
+     * @brief Check if at least one Terminal can start a Transmission
+     * 
+     * @return true     if a Terminal is idle
      */
-    void FinishTransmission(Ptr<Packet> packet);
+    bool HasIdleTerminal() const;
+
+
+    /**
+     * @brief Predict when the Link to a Device may become feasible
+     * 
+     *        The Prediction is the earliest Estimate of all Terminals, bound
+     *        to [MinWakeInterval, MaxWakeInterval].
+     * 
+     * @param other     Target Device
+     * @return Time     Delay until the next Transmission Attempt
+     */
+    Time PredictLinkAvailability(Ptr<NetDevice> other) const;
+
+
+    /**
+     * @brief Check the Global Interconnect Matrix for a Next-Hop
+     * 
+     * @param other     Target Device
+     * @param wake      Delay until the next ICM Epoch, if the Next-Hop is not a known Neighbour
+     * @return true     if the ICM is disabled or lists the Next-Hop
+     */
+    bool IsKnownNeighbour(Ptr<NetDevice> other, Time &wake) const;
 
 
     //LVLHReference m_reflocal;
@@ -248,11 +345,15 @@ private:
     
     uint16_t m_mtu;                             //!< MTU
     uint32_t m_ifIndex;                         //!< Interface index
-    Ptr<Queue<Packet>> m_queue;                 //!< The Queue for outgoing packets.
-    //Ptr<Queue<SatelliteISLSignal>> m_queue;
+    ObjectFactory m_queueFactory;               //!< Factory for the Virtual Output Queues
+    QueueSize m_queueMaxSize;                   //!< Max. Size of each Virtual Output Queue
+    std::unordered_map<uint64_t, VirtualOutputQueue> m_voqs;    //!< Virtual Output Queues by Next-Hop
+    std::deque<uint64_t> m_voqActive;           //!< Round-Robin Order of the non-empty, awake VOQs
 
     bool m_linkUp;                              //!< Indicator - link up / down
-    EventId m_finishTransmissionEvent;            //!< the Tx Complete event
+
+    Time m_minWake;                             //!< Lower Bound of the Wake-Up Interval
+    Time m_maxWake;                             //!< Upper Bound of the Wake-Up Interval
 
 
     /**
@@ -291,6 +392,8 @@ private:
 
 
     TracedCallback<Ptr<const Packet>> m_phyRxTrace;
+    TracedCallback<const SatelliteISLSignal&> m_phyRxSignalTrace;
+    TracedCallback<Ptr<const Packet>> m_macTxDropTrace;
     TracedCallback<Ptr<const Packet>, const Address&> m_phyTxTrace;
 
 
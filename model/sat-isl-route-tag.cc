@@ -0,0 +1,127 @@
+/**
+ * @brief   Satellite ISL Source Route Tag
+ * 
+ * @file    sat-isl-route-tag.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "sat-isl-route-tag.h"
+
+#include "ns3/log.h"
+
+
+namespace ns3
+{
+    NS_LOG_COMPONENT_DEFINE("ISLSourceRouteTag");
+
+    NS_OBJECT_ENSURE_REGISTERED(ISLSourceRouteTag);
+
+
+    TypeId ISLSourceRouteTag::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::ISLSourceRouteTag")
+            .SetParent<Tag>()
+            .SetGroupName("Network")
+            .AddConstructor<ISLSourceRouteTag>();
+    
+        return tid;
+    }
+
+
+    TypeId ISLSourceRouteTag::GetInstanceTypeId() const
+    {
+        return GetTypeId();
+    }
+
+
+    ISLSourceRouteTag::ISLSourceRouteTag()
+    : m_nHops(0), m_ttl(0)
+    {
+    }
+
+
+    uint32_t ISLSourceRouteTag::GetSerializedSize() const
+    {
+        return 2 + 4 * m_nHops;
+    }
+
+
+    void ISLSourceRouteTag::Serialize(TagBuffer i) const
+    {
+        i.WriteU8(m_nHops);
+        i.WriteU8(m_ttl);
+
+        for (size_t n = 0; n < m_nHops; n++)
+        {
+            i.WriteU32(m_hops[n]);
+        }
+    }
+
+
+    void ISLSourceRouteTag::Deserialize(TagBuffer i)
+    {
+        m_nHops = i.ReadU8();
+        m_ttl = i.ReadU8();
+
+        for (size_t n = 0; n < m_nHops; n++)
+        {
+            m_hops[n] = i.ReadU32();
+        }
+    }
+
+
+    void ISLSourceRouteTag::SetHops(const std::vector<Ipv4Address> &hops, uint8_t ttl)
+    {
+        NS_LOG_FUNCTION(this << hops.size() << (uint32_t) ttl);
+        NS_ASSERT_MSG(hops.size() <= MAX_HOPS, "Source Route too long");
+
+        m_nHops = hops.size();
+        m_ttl = ttl;
+        for (size_t n = 0; n < m_nHops; n++)
+        {
+            m_hops[n] = hops[n].Get();
+        }
+    }
+
+
+    size_t ISLSourceRouteTag::GetNHops() const
+    {
+        return m_nHops;
+    }
+
+
+    Ipv4Address ISLSourceRouteTag::GetFirstHop() const
+    {
+        return (m_nHops == 0) ? Ipv4Address() : Ipv4Address(m_hops[0]);
+    }
+
+
+    Ipv4Address ISLSourceRouteTag::GetNextHop(Ipv4Address self, uint8_t ttl) const
+    {
+        // Every Hop decrements the TTL by one, the Difference is the Position on the Path
+        if (ttl > m_ttl) return Ipv4Address();
+
+        size_t n = m_ttl - ttl;
+        if (n + 1 >= m_nHops || m_hops[n] != self.Get()) return Ipv4Address();
+
+        return Ipv4Address(m_hops[n + 1]);
+    }
+
+
+    void ISLSourceRouteTag::Print(std::ostream& os) const
+    {
+        os << "hops=" << (uint32_t) m_nHops << " ttl=" << (uint32_t) m_ttl;
+        for (size_t n = 0; n < m_nHops; n++)
+        {
+            os << " " << Ipv4Address(m_hops[n]);
+        }
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,96 @@
+/**
+ * @brief   Satellite ISL Source Route Tag
+ * 
+ * @file    sat-isl-route-tag.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#ifndef SATELLITE_ISL_ROUTE_TAG_H
+#define SATELLITE_ISL_ROUTE_TAG_H
+
+#include "ns3/tag.h"
+#include "ns3/ipv4-address.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief Hop List of a Source Route, set by the Ingress Satellite
+ * 
+ *        The Gateways of all ISL Hops are carried with the Packet and never changed on the
+ *        Way. The Tag also holds the TTL the Packet arrives with at the first Hop, so a Transit
+ *        Satellite finds its Position from the TTL Difference and forwards to the following
+ *        Hop without a Scan. Hop Addresses are stored as 4 Bytes each.
+ */
+class ISLSourceRouteTag : public Tag
+{
+public:
+
+    static constexpr size_t MAX_HOPS = 255;     //!< Max. Number of Hops in one Tag, Count is serialized as one Byte
+
+
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+
+    ISLSourceRouteTag();
+
+    uint32_t GetSerializedSize() const override;
+    void Serialize(TagBuffer i) const override;
+    void Deserialize(TagBuffer i) override;
+
+
+    /**
+     * @brief Set the Hop List
+     * 
+     * @param hops  Gateways in Order of the Path (at most MAX_HOPS)
+     * @param ttl   TTL of the Packet on Arrival at the first Hop
+     */
+    void SetHops(const std::vector<Ipv4Address> &hops, uint8_t ttl);
+
+    /**
+     * @brief Get the Number of Hops
+     * 
+     * @return size_t 
+     */
+    size_t GetNHops() const;
+
+    /**
+     * @brief Get the first Hop, taken by the Ingress
+     * 
+     * @return Ipv4Address  an invalid Address if the List is empty
+     */
+    Ipv4Address GetFirstHop() const;
+
+    /**
+     * @brief Get the Hop following a Transit Satellite, O(1)
+     * 
+     * @param self          ISL Address of the Transit Satellite
+     * @param ttl           TTL of the received Packet, before the Forwarding decrements it
+     * @return Ipv4Address  an invalid Address if the Address is not on the Path at this TTL or the last Hop
+     */
+    Ipv4Address GetNextHop(Ipv4Address self, uint8_t ttl) const;
+
+
+    void Print(std::ostream& os) const override;
+
+private:
+
+    uint32_t m_hops[MAX_HOPS];          //!< Gateway Addresses of the Path
+    uint8_t m_nHops;                    //!< Number of Hops
+    uint8_t m_ttl;                      //!< TTL at the first Hop
+
+};  /* ISLSourceRouteTag */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_ROUTE_TAG_H */
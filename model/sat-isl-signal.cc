@@ -1,7 +1,7 @@
 /**
  * @brief   Signal Class to hold Parameters for ISLs
  * 
- * @file    sat-isl-signal.h
+ * @file    sat-isl-signal.cc
  * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
  * @version 1.0
  * @date    2024-07-18
@@ -18,39 +18,50 @@ namespace ns3
 {
 
 
-    TypeId SatelliteISLSignal::GetTypeId()
+    SatelliteISLSignal::SatelliteISLSignal()
+    : SatelliteISLSignal(nullptr)
     {
-        static TypeId tid = TypeId("ns3::SatelliteISLSignal")
-            .SetParent<Object>()
-        ;
-
-        return tid;
     }
 
 
-    TypeId SatelliteISLSignal::GetInstanceTypeId() const
+    SatelliteISLSignal::SatelliteISLSignal(Ptr<Packet> pck)
+    : fc(0.0)
+    , relVelocity(0.0)
+    , txPower(0.0)
+    , NoisePwrDb(0.0)
+    , PointingError(0.0)
+    , SnrDb(0.0)
+    , AoA(0.0, 0.0)
+    , AoD(0.0, 0.0)
+    , protocol(0)
+    , m_pck(pck)
+    , m_estimate(0)
     {
-        return GetTypeId();
+
     }
 
 
-    SatelliteISLSignal::SatelliteISLSignal(Ptr<Packet> pck)
-    : AoA(0.0, 0.0)
-    , AoD(0.0, 0.0)
-    , m_pck(pck)
+    void SatelliteISLSignal::SetRateEstimate(DataRate rate)
     {
+        m_estimate = rate;
+    }
+
 
+    DataRate SatelliteISLSignal::GetRateEstimate() const
+    {
+        return m_estimate;
     }
 
 
-    SatelliteISLSignal::~SatelliteISLSignal()
+    void SatelliteISLSignal::SetPacket(const Ptr<Packet> pck)
     {
+        m_pck = pck;
     }
 
 
-    void SatelliteISLSignal::SetRateEstimate(DataRate rate)
+    Ptr<Packet> SatelliteISLSignal::GetPacket() const
     {
-        m_estimate = rate;
+        return m_pck;
     }
 
 
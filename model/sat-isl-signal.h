@@ -15,54 +15,50 @@
 #define SATELLITE_ISL_SIGNAL_H
 
 
-#include "ns3/object.h"
+#include "ns3/ptr.h"
 #include "ns3/packet.h"
 #include "ns3/data-rate.h"
 #include "ns3/angles.h"
+#include "ns3/mac48-address.h"
 
 namespace ns3
 {
 
 
-class SatelliteISLSignal : public Object
+/**
+ * \ingroup satellite
+ * 
+ * The Signal is a plain Value Descriptor of a single Transmission. It is built on the Stack
+ * of the transmitting Terminal and moved by Value through SatelliteISLChannel::Transfer into
+ * the Receive Event of the Receiver, so no Object is allocated per Frame.
+ * 
+ * \brief Physical Layer Descriptor of an ISL Transmission
+ */
+class SatelliteISLSignal
 {
 public:
 
     /**
-     * @brief   Get the Class TypeId
-     * 
-     * @return  TypeId 
+     * @brief TracedCallback Signature for received Signals
      */
-    static TypeId GetTypeId();
+    typedef void (*TracedCallback)(const SatelliteISLSignal &signal);
+
 
     /**
-     * @brief   Get the Class TypeId of an Instance
+     * @brief Default Constructor of SatelliteISLSignal
      * 
-     * @return TypeId 
      */
-    TypeId GetInstanceTypeId() const;
+    SatelliteISLSignal();
 
     /**
      * @brief Constructor of SatelliteISLSignal
      * 
+     * @param pck       Transmitted Packet
      */
     SatelliteISLSignal(Ptr<Packet> pck);
 
-    /**
-     * @brief Copy Constructor of SatelliteISLSignal
-     * 
-     * @param other     Instance to Copy from
-     */
-    SatelliteISLSignal(const SatelliteISLSignal& other);
-
-    /**
-     * @brief Default Destructor
-     * 
-     */
-    ~SatelliteISLSignal();
-
 
-    // void SetPacket(const Ptr<Packet> pck);
+    void SetPacket(const Ptr<Packet> pck);
 
     // void SetSrcNode(const Ptr<Node> scr);
 
@@ -78,11 +74,17 @@ public:
     double NoisePwrDb;
     double PointingError;
 
-    double GetPacket();
+    double SnrDb;         // Signal to Noise Ratio at the Receiver in dB
+
+    Ptr<Packet> GetPacket() const;
+
 
+    Angles AoA;           // Angle of Arrival, relative to the Receiving Terminal
+    Angles AoD;           // Angle of Departure, relative to the Transmitting Terminal
 
-    Angles AoA;
-    Angles AoD;
+    uint16_t protocol;    // Protocol Number of the Payload
+    Mac48Address src;     // MAC Source
+    Mac48Address dst;     // MAC Destination
 
 
 private:
@@ -0,0 +1,245 @@
+/**
+ * @brief   Spatial Index over Satellite Positions
+ *
+ * @file    sat-isl-spatial-index.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-isl-spatial-index.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace ns3
+{
+
+    SatelliteISLSpatialIndex::SatelliteISLSpatialIndex()
+    : m_cellSize(2000e3)
+    , m_maxRings(0)
+    , m_minCell(0)
+    , m_maxCell(0)
+    {
+    }
+
+
+    SatelliteISLSpatialIndex::~SatelliteISLSpatialIndex()
+    {
+    }
+
+
+    void SatelliteISLSpatialIndex::SetCellSize(const double size)
+    {
+        if (size <= 0.0) return;
+        m_cellSize = size;
+    }
+
+
+    double SatelliteISLSpatialIndex::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+
+    size_t SatelliteISLSpatialIndex::GetSize() const
+    {
+        return m_positions.size();
+    }
+
+
+    const Vector& SatelliteISLSpatialIndex::GetPosition(const size_t id) const
+    {
+        return m_positions.at(id);
+    }
+
+
+    void SatelliteISLSpatialIndex::Clear()
+    {
+        m_positions.clear();
+        m_items.clear();
+        m_cells.clear();
+        m_maxRings = 0;
+        m_minCell = 0;
+        m_maxCell = 0;
+    }
+
+
+    void SatelliteISLSpatialIndex::Build(const std::vector<Vector> &positions)
+    {
+        Clear();
+        m_positions = positions;
+
+        size_t N = m_positions.size();
+        if (N == 0) return;
+
+        // Counting Sort of the Items by Cell Key
+        std::vector<uint64_t> keys(N);
+        int64_t min_c = INT64_MAX;
+        int64_t max_c = INT64_MIN;
+
+        for (size_t n = 0; n < N; n++)
+        {
+            const Vector &p = m_positions[n];
+            int64_t ix = _cellCoord(p.x);
+            int64_t iy = _cellCoord(p.y);
+            int64_t iz = _cellCoord(p.z);
+
+            keys[n] = _cellKey(ix, iy, iz);
+            m_cells[keys[n]].count++;
+
+            min_c = std::min({min_c, ix, iy, iz});
+            max_c = std::max({max_c, ix, iy, iz});
+        }
+
+        uint32_t offset = 0;
+        for (auto &cell : m_cells)
+        {
+            cell.second.begin = offset;
+            offset += cell.second.count;
+            cell.second.count = 0;
+        }
+
+        m_items.resize(N);
+        for (size_t n = 0; n < N; n++)
+        {
+            CellRange &cell = m_cells[keys[n]];
+            m_items[cell.begin + cell.count] = n;
+            cell.count++;
+        }
+
+        m_minCell = min_c;
+        m_maxCell = max_c;
+        m_maxRings = max_c - min_c + 1;
+    }
+
+
+    void SatelliteISLSpatialIndex::RangeQuery(const Vector &center, const double range, std::vector<size_t> &result) const
+    {
+        result.clear();
+        if (m_positions.empty() || range < 0.0) return;
+
+        int64_t rings = std::min((int64_t) std::ceil(range / m_cellSize), _ringLimit(center));
+        double range_sq = range * range;
+
+        _visitCells(center, rings, [&](const uint32_t id)
+        {
+            const Vector &p = m_positions[id];
+            double dx = p.x - center.x;
+            double dy = p.y - center.y;
+            double dz = p.z - center.z;
+
+            if (dx * dx + dy * dy + dz * dz <= range_sq)
+            {
+                result.push_back(id);
+            }
+        });
+    }
+
+
+    void SatelliteISLSpatialIndex::NearestQuery(const Vector &center, const size_t k, std::vector<size_t> &result) const
+    {
+        result.clear();
+        if (m_positions.empty() || k == 0) return;
+
+        std::vector<std::pair<double, size_t>> found;
+        const int64_t limit = _ringLimit(center);
+
+        // Grow the searched Cube until the k-th Candidate lies within the fully covered Sphere
+        for (int64_t rings = 1; ; rings++)
+        {
+            found.clear();
+            _visitCells(center, rings, [&](const uint32_t id)
+            {
+                const Vector &p = m_positions[id];
+                double dx = p.x - center.x;
+                double dy = p.y - center.y;
+                double dz = p.z - center.z;
+                found.emplace_back(dx * dx + dy * dy + dz * dz, id);
+            });
+
+            double covered = rings * m_cellSize;
+            bool complete = (found.size() >= k);
+
+            if (complete)
+            {
+                std::nth_element(found.begin(), found.begin() + (k - 1), found.end());
+                complete = (found[k - 1].first <= covered * covered);
+            }
+
+            if (complete || rings >= limit || found.size() == m_positions.size())
+            {
+                break;
+            }
+        }
+
+        size_t M = std::min(k, found.size());
+        std::partial_sort(found.begin(), found.begin() + M, found.end());
+
+        result.reserve(M);
+        for (size_t n = 0; n < M; n++)
+        {
+            result.push_back(found[n].second);
+        }
+    }
+
+
+    template <typename F>
+    void SatelliteISLSpatialIndex::_visitCells(const Vector &center, const int64_t rings, F &&visit) const
+    {
+        int64_t cx = _cellCoord(center.x);
+        int64_t cy = _cellCoord(center.y);
+        int64_t cz = _cellCoord(center.z);
+
+        for (int64_t ix = cx - rings; ix <= cx + rings; ix++)
+        {
+            for (int64_t iy = cy - rings; iy <= cy + rings; iy++)
+            {
+                for (int64_t iz = cz - rings; iz <= cz + rings; iz++)
+                {
+                    auto cell = m_cells.find(_cellKey(ix, iy, iz));
+                    if (cell == m_cells.end()) continue;
+
+                    for (uint32_t n = 0; n < cell->second.count; n++)
+                    {
+                        visit(m_items[cell->second.begin + n]);
+                    }
+                }
+            }
+        }
+    }
+
+
+    int64_t SatelliteISLSpatialIndex::_ringLimit(const Vector &center) const
+    {
+        int64_t outside = 0;
+        for (const double x : {center.x, center.y, center.z})
+        {
+            int64_t c = _cellCoord(x);
+            outside = std::max({outside, m_minCell - c, c - m_maxCell});
+        }
+
+        return m_maxRings + outside;
+    }
+
+
+    int64_t SatelliteISLSpatialIndex::_cellCoord(const double x) const
+    {
+        return (int64_t) std::floor(x / m_cellSize);
+    }
+
+
+    uint64_t SatelliteISLSpatialIndex::_cellKey(const int64_t ix, const int64_t iy, const int64_t iz)
+    {
+        // 21 Bit per Axis, enough for any Orbit with Cells down to a few m
+        const uint64_t mask = (1ULL << 21) - 1;
+        return (((uint64_t) ix & mask) << 42) | (((uint64_t) iy & mask) << 21) | ((uint64_t) iz & mask);
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,152 @@
+/**
+ * @brief   Spatial Index over Satellite Positions
+ *
+ * @file    sat-isl-spatial-index.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ISL_SPATIAL_INDEX_H
+#define SATELLITE_ISL_SPATIAL_INDEX_H
+
+
+#include "ns3/vector.h"
+
+#include <unordered_map>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+    /**
+     * @ingroup satellite
+     *
+     * @brief Uniform Grid over Satellite Positions for Range and k-Nearest Queries
+     *
+     *        Items are bucketed into cubic Cells and stored contiguously, sorted by Cell.
+     *        A Query only visits the Cells overlapping its Sphere, so the Cost scales with
+     *        the Number of Neighbours instead of the Number of Satellites. The Index is a
+     *        Snapshot; it is rebuilt by its Owner once per Time Step.
+     */
+    class SatelliteISLSpatialIndex
+    {
+    public:
+
+        SatelliteISLSpatialIndex();
+        ~SatelliteISLSpatialIndex();
+
+
+        /**
+         * @brief Set the Edge Length of a Grid Cell, should be close to the typical Query Range
+         *
+         * @param size      Cell Size in m
+         */
+        void SetCellSize(const double size);
+
+        double GetCellSize() const;
+
+
+        /**
+         * @brief Rebuild the Index from a Set of Positions
+         *
+         * @param positions     Position by Item Index
+         */
+        void Build(const std::vector<Vector> &positions);
+
+
+        /**
+         * @brief Remove all Items
+         */
+        void Clear();
+
+
+        /**
+         * @brief Get all Items within a Range around a Position
+         *
+         * @param center    Query Position
+         * @param range     Max. Distance in m
+         * @param result    Output, Item Indices (unsorted)
+         */
+        void RangeQuery(const Vector &center, const double range, std::vector<size_t> &result) const;
+
+
+        /**
+         * @brief Get the k nearest Items around a Position
+         *
+         * @param center    Query Position
+         * @param k         Number of Items
+         * @param result    Output, Item Indices sorted by Distance
+         */
+        void NearestQuery(const Vector &center, const size_t k, std::vector<size_t> &result) const;
+
+
+        /**
+         * @brief Get the Number of indexed Items
+         *
+         * @return size_t
+         */
+        size_t GetSize() const;
+
+
+        /**
+         * @brief Get the indexed Position of an Item
+         *
+         * @param id        Item Index
+         * @return const Vector&
+         */
+        const Vector& GetPosition(const size_t id) const;
+
+
+    private:
+
+        typedef struct
+        {
+            uint32_t begin;     //!< First Slot in m_items
+            uint32_t count;     //!< Number of Items in the Cell
+        } CellRange;
+
+
+        int64_t _cellCoord(const double x) const;
+
+        static uint64_t _cellKey(const int64_t ix, const int64_t iy, const int64_t iz);
+
+
+        /**
+         * @brief Visit all Items in the Cells of a Cube of (2*rings+1)^3 Cells
+         */
+        template <typename F>
+        void _visitCells(const Vector &center, const int64_t rings, F &&visit) const;
+
+        /**
+         * @brief Get the Rings around a Query Center that cover all occupied Cells
+         *
+         *        A Center outside the occupied Box first needs its Cell Distance to the Box.
+         */
+        int64_t _ringLimit(const Vector &center) const;
+
+
+        double m_cellSize;                                  //!< Edge Length of a Cell in m
+
+        std::vector<Vector> m_positions;                    //!< Position by Item Index
+        std::vector<uint32_t> m_items;                      //!< Item Indices sorted by Cell
+        std::unordered_map<uint64_t, CellRange> m_cells;    //!< Occupied Cells
+
+        int64_t m_maxRings;                                 //!< Rings to cover all occupied Cells from within their Box
+        int64_t m_minCell;                                  //!< Lowest Cell Coordinate of the occupied Box
+        int64_t m_maxCell;                                  //!< Highest Cell Coordinate of the occupied Box
+
+    };  /* SatelliteISLSpatialIndex */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_SPATIAL_INDEX_H */
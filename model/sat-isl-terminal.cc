@@ -18,9 +18,12 @@
 #include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/node.h"
+#include "ns3/simulator.h"
 #include "ns3/vector-extensions.h"
 #include "ns3/sat-isl-pck-tag.h"
 #include "ns3/sat-isl-channel.h"
+#include "ns3/sat-isl-net-device.h"
+#include "ns3/sat-isl-antenna.h"
 #include "ns3/satellite-const-variables.h"
 
 namespace ns3
@@ -30,6 +33,11 @@ namespace ns3
     NS_OBJECT_ENSURE_REGISTERED(SatelliteISLTerminal);
 
 
+    static const double ISL_CENTER_FREQUENCY = 40e9;     //! Center Frequency in Hz
+    static const double ISL_BANDWIDTH_FACTOR = 0.02;     //! Bandwidth relative to fc
+    static const double ISL_TX_POWER_DBM = 45.0;         //! Transmit Power in dBm
+
+
 
     TypeId SatelliteISLTerminal::GetTypeId()
     {
@@ -89,6 +97,20 @@ namespace ns3
                 , MakeBooleanAccessor(&SatelliteISLTerminal::m_updateOrientation)
                 , MakeBooleanChecker()
             )
+            .AddAttribute(
+                "CenterFrequency"
+                , "Center Frequency of the Transmitter in Hz, the Bandwidth scales with it."
+                , DoubleValue(ISL_CENTER_FREQUENCY)
+                , MakeDoubleAccessor(&SatelliteISLTerminal::SetCenterFrequency, &SatelliteISLTerminal::GetCenterFrequency)
+                , MakeDoubleChecker<double>(1.0)
+            )
+            .AddAttribute(
+                "TxPower"
+                , "Transmit Power in dBm"
+                , DoubleValue(ISL_TX_POWER_DBM)
+                , MakeDoubleAccessor(&SatelliteISLTerminal::SetTxPower, &SatelliteISLTerminal::GetTxPower)
+                , MakeDoubleChecker<double>()
+            )
         ;
 
         return tid;
@@ -103,7 +125,10 @@ namespace ns3
 
     SatelliteISLTerminal::SatelliteISLTerminal()
     : m_orientation(Quaternion())
+    , m_fc(ISL_CENTER_FREQUENCY)
+    , m_txPower(ISL_TX_POWER_DBM)
     {
+        m_budget.valid = false;
     }
 
 
@@ -112,6 +137,20 @@ namespace ns3
     }
 
 
+    void SatelliteISLTerminal::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        m_txCompleteEvent.Cancel();
+        m_txCompleteCallback = MakeNullCallback<void, Ptr<SatelliteISLTerminal>, Ptr<Packet>>();
+        m_antenna = nullptr;
+        m_islAntenna = nullptr;
+        m_budget.loss = nullptr;
+        m_ref = nullptr;
+
+        Object::DoDispose();
+    }
+
+
     // Ptr<MobilityModel> SatelliteISLTerminal::GetParentMobility() const
     // {
     //     NS_LOG_FUNCTION(this);
@@ -157,6 +196,27 @@ namespace ns3
     {
         NS_LOG_FUNCTION(this << fc);
         m_fc = fc;
+        m_budget.valid = false;
+    }
+
+
+    double SatelliteISLTerminal::GetCenterFrequency() const
+    {
+        return m_fc;
+    }
+
+
+    void SatelliteISLTerminal::SetTxPower(const double power)
+    {
+        NS_LOG_FUNCTION(this << power);
+        m_txPower = power;
+        m_budget.valid = false;
+    }
+
+
+    double SatelliteISLTerminal::GetTxPower() const
+    {
+        return m_txPower;
     }
 
 
@@ -232,6 +292,8 @@ namespace ns3
     {
         NS_LOG_FUNCTION(this << antenna);
         m_antenna = antenna;
+        m_islAntenna = DynamicCast<SatelliteISLAntenna>(antenna);
+        m_budget.valid = false;
     }
 
 
@@ -288,35 +350,181 @@ namespace ns3
     }
 
 
+    bool SatelliteISLTerminal::IsInFieldOfView(const Vector &satpos) const
+    {
+        return _getGainLinear(GetRelativeAngles(satpos)) > 0.0;
+    }
+
+
     DataRate SatelliteISLTerminal::GetRateEstimation(const Ptr<MobilityModel> self, Ptr<MobilityModel> other, const Ptr<PropagationLossModel> loss, const double noise_temperature) const
     {
-        double fc = 40e9;
-        double B = fc * 0.02;
+        const LinkBudget &budget = _getLinkBudget(loss, noise_temperature);
+
+        double gain = _getGainLinear(GetRelativeAngles(other->GetPosition()));
+        if (!(gain > 0.0)) return DataRate(0);
+
+        double snr = _getSnr(budget, self, other, gain);
+        if (!(snr > 0.0)) return DataRate(0);
+
+        uint64_t rate = (uint64_t) std::floor(budget.bandwidth * log2(1 + snr));
+
+        NS_LOG_FUNCTION(this << "\t" << gain << "\t" << snr << "\t" << rate / 1000.0 << " kbps");
+
+        return DataRate(rate);
+    }
+
+
+    const SatelliteISLTerminal::LinkBudget& SatelliteISLTerminal::_getLinkBudget(const Ptr<PropagationLossModel> loss, const double noise_temperature) const
+    {
+        if (m_budget.valid && m_budget.loss == loss && m_budget.noiseTemperature == noise_temperature)
+        {
+            if (!m_budget.friis || m_budget.checked == Simulator::Now())
+            {
+                return m_budget;
+            }
+
+            // Attributes of the same Loss Object may have changed since the last Check
+            DoubleValue system_loss;
+            DoubleValue min_loss;
+            loss->GetAttribute("SystemLoss", system_loss);
+            loss->GetAttribute("MinLoss", min_loss);
+
+            m_budget.checked = Simulator::Now();
+            if (system_loss.Get() == m_budget.systemLoss && min_loss.Get() == m_budget.minLoss)
+            {
+                return m_budget;
+            }
+        }
+
+        NS_LOG_FUNCTION(this << loss << noise_temperature);
+
+        LinkBudget &b = m_budget;
+        b.loss = loss;
+        b.noiseTemperature = noise_temperature;
+
+        b.wavelength = SatConstVariables::SPEED_OF_LIGHT / m_fc;
+        b.bandwidth = m_fc * ISL_BANDWIDTH_FACTOR;
+        b.noiseFloor = SatConstVariables::BOLTZMANN_CONSTANT * noise_temperature * b.bandwidth;
+
+        // Tx Power is taken in mW over a Noise Floor in W, the Scaling of the Estimation so far
+        b.snrCoefficient = std::pow(10.0, 0.1 * m_txPower) / b.noiseFloor;
+
+        // Friis is evaluated in closed Form with the Terminal Wavelength, other Models are queried per Call
+        Ptr<FriisPropagationLossModel> friis = DynamicCast<FriisPropagationLossModel>(loss);
+        b.friis = (friis != nullptr);
+
+        if (b.friis)
+        {
+            DoubleValue system_loss;
+            DoubleValue min_loss;
+            friis->GetAttribute("SystemLoss", system_loss);
+            friis->GetAttribute("MinLoss", min_loss);
+
+            b.systemLoss = system_loss.Get();
+            b.minLoss = min_loss.Get();
+            b.checked = Simulator::Now();
+
+            b.pathCoefficient = std::pow(b.wavelength / (4.0 * M_PI), 2.0) / system_loss.Get();
+            b.maxPathGain = std::pow(10.0, -0.1 * min_loss.Get());
+            b.nearFieldSq = std::pow(3.0 * b.wavelength, 2.0);
+        }
+
+        b.valid = true;
+        return m_budget;
+    }
+
+
+    double SatelliteISLTerminal::_getSnr(const LinkBudget &budget, const Ptr<MobilityModel> self, const Ptr<MobilityModel> other, const double gain) const
+    {
+        if (budget.friis)
+        {
+            Vector d = other->GetPosition() - self->GetPosition();
+            double d_sq = d.x * d.x + d.y * d.y + d.z * d.z;
+
+            double path = (d_sq <= budget.nearFieldSq) ? budget.maxPathGain : std::min(budget.maxPathGain, budget.pathCoefficient / d_sq);
+            return budget.snrCoefficient * path * gain;
+        }
+
+        double rx_dbm = budget.loss->CalcRxPower(m_txPower, self, other);
+        if (isnan(rx_dbm)) return 0.0;
+
+        return std::pow(10.0, 0.1 * rx_dbm) * gain / budget.noiseFloor;
+    }
+
+
+    double SatelliteISLTerminal::_getGainLinear(const Angles &angles) const
+    {
+        if (m_islAntenna != nullptr)
+        {
+            return m_islAntenna->GetGainLinear(angles);
+        }
 
+        return std::pow(10.0, 0.1 * m_antenna->GetGainDb(angles));
+    }
+
+
+    Time SatelliteISLTerminal::EstimateTimeToLink(const Ptr<MobilityModel> self, Ptr<MobilityModel> other, const Ptr<PropagationLossModel> loss, const double noise_temperature, const DataRate minRate) const
+    {
+        Vector pos_self = self->GetPosition();
+        Vector vel_self = self->GetVelocity();
+        Vector los = other->GetPosition() - pos_self;
+        Vector vel_rel = other->GetVelocity() - vel_self;
 
-        Ptr<FriisPropagationLossModel> lossm = StaticCast<FriisPropagationLossModel>(loss);
+        double dist = los.GetLength();
+        double speed = vel_rel.GetLength();
 
-        lossm->SetFrequency(fc);
+        if (dist == 0.0) return Time(0);
 
-        double loss_dbm = lossm->CalcRxPower(45, self, other);
+        // (1) Aperture: the Target leaves the Antenna Opening at most with the Rotation Rate of the
+        //     Line-of-Sight plus the Rotation Rate of the LVLH Frame (orbital angular Rate).
+        double t_fov = 0.0;
+        double max_gain = 0.0;
 
         Angles ant_angles = GetRelativeAngles(other->GetPosition());
 
-        double ant_gain = m_antenna->GetGainDb(ant_angles);
+        if (m_islAntenna != nullptr)
+        {
+            max_gain = m_islAntenna->GetGainLinear(Angles(0.0, ant_angles.GetInclination()));
 
+            double excess = std::abs(ant_angles.GetAzimuth()) - DegreesToRadians(m_islAntenna->GetOpeningAngle());
+            if (excess > 0.0)
+            {
+                double los_rate = CrossProduct(los, vel_rel).GetLength() / (dist * dist);
+                double frame_rate = CrossProduct(pos_self, vel_self).GetLength() / std::pow(pos_self.GetLength(), 2.0);
 
-        if (isnan(loss_dbm) || isnan(ant_gain)) return DataRate(0);
+                // Azimuth moves faster close to the Poles of the Terminal Frame
+                double sin_inc = std::max(std::abs(std::sin(ant_angles.GetInclination())), 1e-3);
+                double omega = (los_rate + frame_rate) / sin_inc;
 
+                if (omega <= 0.0) return Time::Max();
+                t_fov = excess / omega;
+            }
+        }
+        else
+        {
+            max_gain = _getGainLinear(ant_angles);
+        }
 
-        double kBT = SatConstVariables::BOLTZMANN_CONSTANT * noise_temperature * B;
-        double S = std::pow(10.0, 0.1 * (((loss_dbm + ant_gain)))); //- 30.0)));
-        uint64_t rate =(uint64_t)  std::floor(B * log2(1 + (S / kBT)));
+        // (2) Link Budget: distance to close before the SNR at max. Gain supports minRate
+        const LinkBudget &budget = _getLinkBudget(loss, noise_temperature);
 
+        double snr = _getSnr(budget, self, other, max_gain);
+        double snr_req = std::pow(2.0, minRate.GetBitRate() / budget.bandwidth) - 1.0;
 
-        NS_LOG_FUNCTION(this << "\t" << loss_dbm << "\t" << ant_gain << "\t" << 10 * std::log10(S / kBT) << "\t" << rate / 1000.0 << " kbps");
+        if (isnan(snr)) return Time(0);
 
+        double t_range = 0.0;
+        if (snr < snr_req)
+        {
+            if (speed <= 0.0 || !(snr > 0.0)) return Time::Max();
 
-        return DataRate(rate);
+            double dist_req = dist * std::sqrt(snr / snr_req);
+            t_range = (dist - dist_req) / speed;
+        }
+
+        NS_LOG_FUNCTION(this << "\t" << t_fov << "\t" << t_range);
+
+        return Seconds(std::max(t_fov, t_range));
     }
 
 
@@ -341,11 +549,28 @@ namespace ns3
         DataRate dr = GetRateEstimation(self_mob, other_mob, loss, sat_chn->GetNoiseTemperature());
         // NS_LOG_UNCOND("Rate: " << dr.GetBitRate());
 
+        return Transmit(pck, src_dev, other, chn, dr);
+    }
+
+
+    Time SatelliteISLTerminal::Transmit(Ptr<Packet> pck, Ptr<NetDevice> src_dev, Ptr<NetDevice> other, Ptr<Channel> chn, DataRate dr)
+    {
+        NS_LOG_FUNCTION(this << pck << other << dr);
+
+        Ptr<SatelliteISLChannel> sat_chn = StaticCast<SatelliteISLChannel>(chn);
+
         if (dr.GetBitRate() <= 0)
         {
             return Time(0);
         }
 
+        // One Transmission at a Time, a second one would schedule a second Completion
+        if (IsBusy())
+        {
+            NS_LOG_FUNCTION(this << "Terminal busy - Transmission rejected");
+            return Time(0);
+        }
+
 
         ISLPacketTag tag;
         pck->PeekPacketTag(tag);
@@ -354,17 +579,75 @@ namespace ns3
         Mac48Address dst = tag.GetDst();
         uint16_t proto = tag.GetProto();
 
-        Ptr<SatelliteISLSignal> signal = CreateObject<SatelliteISLSignal>(pck);
-        signal->SetRateEstimate(dr);
-        
-        //sat_chn->Transfer(signal, src_dev);
+        Ptr<MobilityModel> other_mob = other->GetNode()->GetObject<MobilityModel>();
+        Ptr<MobilityModel> self_mob = src_dev->GetNode()->GetObject<MobilityModel>();
 
+        if (other_mob == nullptr || self_mob == nullptr)
+        {
+            NS_LOG_FUNCTION(this << "Critical Error, No Mobility model associated!");
+            return Time(0);
+        }
 
-        sat_chn->Send(pck, proto, dst, src, src_dev);
+        // Descriptor lives on the Stack, the Channel moves it by Value to the Receiver
+        const LinkBudget &budget = _getLinkBudget(sat_chn->GetPropagationLossModel(), sat_chn->GetNoiseTemperature());
+        Vector los = other_mob->GetPosition() - self_mob->GetPosition();
+
+        SatelliteISLSignal signal(pck);
+        signal.fc = m_fc;
+        signal.txPower = m_txPower - 30.0;
+        signal.relVelocity = (other_mob->GetVelocity() - self_mob->GetVelocity()).GetLength();
+        signal.SnrDb = 10.0 * std::log10(std::pow(2.0, dr.GetBitRate() / budget.bandwidth) - 1.0);
+        signal.NoisePwrDb = 10.0 * std::log10(budget.noiseFloor);
+        signal.AoD = GetRelativeAngles(other_mob->GetPosition());
+        signal.AoA = Angles(Vector(-los.x, -los.y, -los.z));
+
+        // AoA relative to the receiving Terminal like the AoD, the first one whose Aperture holds the Transmitter
+        Ptr<SatelliteISLNetDevice> rx_dev = DynamicCast<SatelliteISLNetDevice>(other);
+        for (size_t n = 0; rx_dev != nullptr && n < rx_dev->GetNTerminals(); n++)
+        {
+            Angles aoa = rx_dev->GetISLTerminal(n)->GetRelativeAngles(self_mob->GetPosition());
+            bool seen = rx_dev->GetISLTerminal(n)->_getGainLinear(aoa) > 0.0;
+
+            if (n == 0 || seen) signal.AoA = aoa;
+            if (seen) break;
+        }
+
+        signal.protocol = proto;
+        signal.src = src;
+        signal.dst = dst;
+        signal.SetRateEstimate(dr);
+
+        sat_chn->Transfer(signal, src_dev);
 
         Time txTime = dr.CalculateBytesTxTime(pck->GetSize());
+        m_txCompleteEvent = Simulator::Schedule(txTime, &SatelliteISLTerminal::CompleteTransmission, this, pck);
+
         return txTime; 
     }
 
 
+    bool SatelliteISLTerminal::IsBusy() const
+    {
+        return m_txCompleteEvent.IsRunning();
+    }
+
+
+    void SatelliteISLTerminal::SetTxCompleteCallback(TxCompleteCallback callback)
+    {
+        NS_LOG_FUNCTION(this);
+        m_txCompleteCallback = callback;
+    }
+
+
+    void SatelliteISLTerminal::CompleteTransmission(Ptr<Packet> pck)
+    {
+        NS_LOG_FUNCTION(this << pck);
+
+        if (!m_txCompleteCallback.IsNull())
+        {
+            m_txCompleteCallback(this, pck);
+        }
+    }
+
+
 }   /* namespace ns3 */
\ No newline at end of file
@@ -16,6 +16,8 @@
 
 
 #include "ns3/object.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
 #include "ns3/mac48-address.h"
 #include "ns3/antenna-model.h"
 #include "ns3/mobility-model.h"
@@ -25,6 +27,8 @@
 #include "ns3/packet.h"
 #include "ns3/propagation-loss-model.h"
 
+#include "ns3/sat-isl-antenna.h"
+
 
 namespace ns3
 {
@@ -55,6 +59,9 @@ public:
     } ISLTerminalType_t;
 
 
+    typedef Callback<void, Ptr<SatelliteISLTerminal>, Ptr<Packet>> TxCompleteCallback;
+
+
     static TypeId GetTypeId();
     TypeId GetInstanceTypeId() const;
 
@@ -146,6 +153,18 @@ public:
      */
     void SetCenterFrequency(double fc);
 
+    double GetCenterFrequency() const;
+
+
+    /**
+     * @brief Set the Transmit Power
+     * 
+     * @param power     Transmit Power in dBm
+     */
+    void SetTxPower(const double power);
+
+    double GetTxPower() const;
+
 
     // /**
     //  * @brief Setup the Terminal to use an internal NetDevice
@@ -189,6 +208,16 @@ public:
     
     double GetAntennaGain(const Ptr<MobilityModel> self, Ptr<MobilityModel> other) const;
 
+    /**
+     * @brief Check if a Position lies within the Aperture of the Antenna
+     * 
+     *        The Local Reference must be up to date with the Parent Mobility.
+     * 
+     * @param satpos    Other Satellite Position
+     * @return true     if the Antenna Gain towards the Position is non-zero
+     */
+    bool IsInFieldOfView(const Vector &satpos) const;
+
 
     /**
      * @brief Estimate the achievable Data Rate to Target
@@ -201,6 +230,23 @@ public:
      */
     DataRate GetRateEstimation(const Ptr<MobilityModel> self, Ptr<MobilityModel> other, const Ptr<PropagationLossModel> loss, const double noise_temperature) const;
 
+
+    /**
+     * @brief Predict the earliest Time the Link to the Target can reach minRate
+     * 
+     *        The Prediction is a lower bound from the Antenna Aperture (angular Rate of the
+     *        Line-of-Sight relative to the rotating LVLH Frame) and the Link Budget (closing
+     *        Speed needed to reach the required SNR at max. Antenna Gain).
+     * 
+     * @param self      Mobility Model Transmitter
+     * @param other     Mobility Model Receiver
+     * @param loss      Loss Model
+     * @param noise_temperature  Noise Temperature
+     * @param minRate   Data Rate the Link must achieve
+     * @return Time     Time until the Link may become feasible, Time::Max() if never
+     */
+    Time EstimateTimeToLink(const Ptr<MobilityModel> self, Ptr<MobilityModel> other, const Ptr<PropagationLossModel> loss, const double noise_temperature, const DataRate minRate) const;
+
     /**
      * @brief   Transmit Packet to other Satellite
      * 
@@ -213,11 +259,101 @@ public:
     Time Transmit(Ptr<Packet> pck,Ptr<NetDevice> src, Ptr<NetDevice> dst, Ptr<Channel> chn);
 
 
+    /**
+     * @brief   Transmit Packet to other Satellite with a known Rate
+     * 
+     *          Used with the Rate of the Link-State Oracle to skip a second Estimation.
+     * 
+     * @param pck 
+     * @param src 
+     * @param dst 
+     * @param chn 
+     * @param rate      Rate to transmit with
+     * @return Time     TxTime, zero if the Terminal is busy or the Rate is zero
+     */
+    Time Transmit(Ptr<Packet> pck, Ptr<NetDevice> src, Ptr<NetDevice> dst, Ptr<Channel> chn, DataRate rate);
+
+
+    /**
+     * @brief Check if the Terminal is currently transmitting
+     * 
+     * @return true     while a Transmission is in Progress
+     */
+    bool IsBusy() const;
+
+
+    /**
+     * @brief Set the Callback invoked when a Transmission of this Terminal is completed
+     * 
+     * @param callback 
+     */
+    void SetTxCompleteCallback(TxCompleteCallback callback);
+
+
     // Ptr<SatelliteISLNetDevice> GetNetDevice() const;
 
 
+protected:
+
+    void DoDispose() override;
+
+
 private:
 
+    /**
+     * @brief Link Budget Coefficients of the Terminal, derived once per Configuration
+     * 
+     *        With a Friis Loss Model the SNR reduces to snrCoefficient * PathGain(d^2) * Gain.
+     */
+    typedef struct
+    {
+        Ptr<PropagationLossModel> loss;     //!< Loss Model the Budget was derived for
+        double noiseTemperature;            //!< Noise Temperature the Budget was derived for
+        double systemLoss;                  //!< Friis SystemLoss the Budget was derived for
+        double minLoss;                     //!< Friis MinLoss the Budget was derived for in dB
+        Time checked;                       //!< Simulation Time the Loss Attributes were last compared
+        bool valid;                         //!< Budget is up to date with the Configuration
+        bool friis;                         //!< Path Gain is evaluated in closed Form
+
+        double wavelength;                  //!< Wavelength in m
+        double bandwidth;                   //!< Bandwidth in Hz
+        double noiseFloor;                  //!< Noise Power kTB in W
+        double snrCoefficient;              //!< Tx Power over Noise Floor
+        double pathCoefficient;             //!< (lambda / 4 pi)^2 / SystemLoss
+        double maxPathGain;                 //!< Path Gain Limit from MinLoss
+        double nearFieldSq;                 //!< Squared Distance below which Friis returns MinLoss
+    } LinkBudget;
+
+
+    /**
+     * @brief Get the Link Budget, recalculated only if the Configuration changed
+     * 
+     *        The Attributes of a Friis Loss Model are compared at most once per Simulation Time,
+     *        so changing them on the same Loss Object invalidates the Budget as well.
+     */
+    const LinkBudget& _getLinkBudget(const Ptr<PropagationLossModel> loss, const double noise_temperature) const;
+
+
+    /**
+     * @brief Get the linear SNR for a linear Antenna Gain
+     */
+    double _getSnr(const LinkBudget &budget, const Ptr<MobilityModel> self, const Ptr<MobilityModel> other, const double gain) const;
+
+
+    /**
+     * @brief Get the linear Antenna Gain towards a Position
+     */
+    double _getGainLinear(const Angles &angles) const;
+
+
+    /**
+     * @brief Finish the Transmission in Progress and notify the Device
+     * 
+     * @param pck   Transmitted Packet
+     */
+    void CompleteTransmission(Ptr<Packet> pck);
+
+
     bool m_setup;
 
     bool m_updateOrientation;
@@ -228,6 +364,7 @@ private:
     // Ptr<MobilityModel> m_mobility;
     // Ptr<SatelliteISLChannel> m_channel;
     Ptr<AntennaModel> m_antenna;
+    Ptr<SatelliteISLAntenna> m_islAntenna;      //!< m_antenna if it is a SatelliteISLAntenna
 
     //Ptr<OrientationHelper> m_orient;
 
@@ -243,12 +380,19 @@ private:
     bool m_sharedNetDevice;
 
     double      m_fc;
+    double      m_txPower;
     double      m_dopplerBw;
     bool        m_dopplerMitigation;
 
 
     Ptr<PropagationLossModel> m_lossModel;
 
+    mutable LinkBudget m_budget;                //!< Cached Link Budget
+
+
+    EventId m_txCompleteEvent;                  //!< Tx Complete event of this Terminal
+    TxCompleteCallback m_txCompleteCallback;    //!< Notify Device about a completed Transmission
+
 
 
     // Ptr<FriisPropagationLossModel> _getPropagationLossModel() const;
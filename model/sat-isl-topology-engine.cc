@@ -0,0 +1,428 @@
+/**
+ * @brief   Visibility-based ISL Topology Engine
+ *
+ * @file    sat-isl-topology-engine.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-isl-topology-engine.h"
+#include "sat-isl-channel.h"
+#include "sat-isl-net-device.h"
+#include "ns3/sat-node-tag.h"
+
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
+#include "ns3/mobility-model.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <algorithm>
+#include <math.h>
+
+
+namespace ns3
+{
+
+    NS_LOG_COMPONENT_DEFINE("SatISLTopologyEngine");
+    NS_OBJECT_ENSURE_REGISTERED(SatISLTopologyEngine);
+
+
+    static const double EARTH_RADIUS_EQ = 6378137.0;        //! Equatorial Radius in m
+
+
+    TypeId SatISLTopologyEngine::GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::SatISLTopologyEngine")
+            .SetParent<Object>()
+            .AddConstructor<SatISLTopologyEngine>()
+            .AddAttribute(
+                "Interval"
+                , "Time Step of the Topology Evaluation"
+                , TimeValue(Seconds(1))
+                , MakeTimeAccessor(&SatISLTopologyEngine::m_interval)
+                , MakeTimeChecker(Time(1))
+            )
+            .AddAttribute(
+                "MaxRange"
+                , "Max. Link Distance in m"
+                , DoubleValue(5000e3)
+                , MakeDoubleAccessor(&SatISLTopologyEngine::m_maxRange)
+                , MakeDoubleChecker<double>(0.0)
+            )
+            .AddAttribute(
+                "GrazingAltitude"
+                , "Min. Altitude of the Line-of-Sight above the Earth in m (Atmosphere)"
+                , DoubleValue(80e3)
+                , MakeDoubleAccessor(&SatISLTopologyEngine::m_grazingAltitude)
+                , MakeDoubleChecker<double>(0.0)
+            )
+            .AddAttribute(
+                "FieldOfView"
+                , "Require each End to lie within the Aperture of a Terminal of the other End"
+                , BooleanValue(true)
+                , MakeBooleanAccessor(&SatISLTopologyEngine::m_checkFov)
+                , MakeBooleanChecker()
+            )
+            .AddAttribute(
+                "UpdateICM"
+                , "Apply the Link Differences to the Interconnect Matrix"
+                , BooleanValue(true)
+                , MakeBooleanAccessor(&SatISLTopologyEngine::m_updateIcm)
+                , MakeBooleanChecker()
+            )
+            .AddTraceSource(
+                "LinkUp"
+                , "A Link became feasible"
+                , MakeTraceSourceAccessor(&SatISLTopologyEngine::m_linkUpTrace)
+                , "ns3::SatISLTopologyEngine::LinkTracedCallback"
+            )
+            .AddTraceSource(
+                "LinkDown"
+                , "A Link became infeasible"
+                , MakeTraceSourceAccessor(&SatISLTopologyEngine::m_linkDownTrace)
+                , "ns3::SatISLTopologyEngine::LinkTracedCallback"
+            )
+        ;
+
+        return tid;
+    }
+
+
+    SatISLTopologyEngine::SatISLTopologyEngine()
+    : m_channel(nullptr)
+    , m_icm(nullptr)
+    , m_interval(Seconds(1))
+    , m_maxRange(5000e3)
+    , m_grazingAltitude(80e3)
+    , m_checkFov(true)
+    , m_updateIcm(true)
+    {
+    }
+
+
+    SatISLTopologyEngine::~SatISLTopologyEngine()
+    {
+    }
+
+
+    void SatISLTopologyEngine::DoDispose()
+    {
+        NS_LOG_FUNCTION(this);
+        Stop();
+
+        m_channel = nullptr;
+        m_icm = nullptr;
+        m_index.Clear();
+        m_links.clear();
+        m_next.clear();
+        m_up.clear();
+        m_satLinks.clear();
+
+        Object::DoDispose();
+    }
+
+
+    void SatISLTopologyEngine::SetChannel(Ptr<SatelliteISLChannel> channel)
+    {
+        NS_LOG_FUNCTION(this << channel);
+
+        // The Links of the old Channel go down, so neither the ICM nor the Listeners keep them
+        if (m_channel != nullptr && !m_links.empty())
+        {
+            for (const uint64_t link : m_links)
+            {
+                _apply(link, false);
+            }
+
+            if (m_updateIcm) ((m_icm != nullptr) ? m_icm : SatISLInterconTable::Get())->Commit();
+        }
+
+        m_channel = channel;
+        m_links.clear();
+        m_up.clear();
+        m_satLinks.clear();
+    }
+
+
+    void SatISLTopologyEngine::SetInterconTable(Ptr<SatISLInterconTable> icm)
+    {
+        m_icm = icm;
+    }
+
+
+    void SatISLTopologyEngine::Start()
+    {
+        NS_LOG_FUNCTION(this);
+        Stop();
+        _step();
+    }
+
+
+    void SatISLTopologyEngine::Stop()
+    {
+        m_stepEvent.Cancel();
+    }
+
+
+    void SatISLTopologyEngine::_step()
+    {
+        Update();
+        m_stepEvent = Simulator::Schedule(m_interval, &SatISLTopologyEngine::_step, this);
+    }
+
+
+    size_t SatISLTopologyEngine::Update()
+    {
+        NS_ASSERT_MSG(m_channel != nullptr, "No Channel set");
+
+        const size_t N = m_channel->GetNDevices();
+        NS_LOG_FUNCTION(this << N);
+
+        m_positions.resize(N);
+        m_satIds.resize(N);
+
+        for (size_t n = 0; n < N; n++)
+        {
+            Ptr<SatelliteISLNetDevice> dev = m_channel->GetISLDevice(n);
+            Ptr<MobilityModel> mob = dev->GetNode()->GetObject<MobilityModel>();
+            NS_ASSERT_MSG(mob != nullptr, "ISL Device without Mobility Model");
+
+            m_positions[n] = mob->GetPosition();
+
+            Ptr<SatelliteNodeTag> tag = dev->GetNode()->GetObject<SatelliteNodeTag>();
+            m_satIds[n] = (tag != nullptr) ? tag->GetId() : 0;
+
+            // Terminal Angles are relative to the Local Reference of their Device
+            if (m_checkFov)
+            {
+                dev->GetLocalReference()->UpdateLocalReference(mob);
+            }
+        }
+
+        // Candidate Pairs (a < b) within the MaxRange
+        m_index.SetCellSize(m_maxRange);
+        m_index.Build(m_positions);
+
+        m_pairA.clear();
+        m_pairB.clear();
+
+        std::vector<size_t> ids;
+        for (size_t a = 0; a < N; a++)
+        {
+            m_index.RangeQuery(m_positions[a], m_maxRange, ids);
+            for (const size_t b : ids)
+            {
+                if (b <= a) continue;
+                m_pairA.push_back(a);
+                m_pairB.push_back(b);
+            }
+        }
+
+        size_t count = _occlusion(m_pairA.size());
+
+        m_next.clear();
+        for (size_t k = 0; k < count; k++)
+        {
+            if (m_checkFov && !_fieldOfView(m_pairA[k], m_pairB[k])) continue;
+            m_next.push_back(_key(m_pairA[k], m_pairB[k]));
+        }
+
+        std::sort(m_next.begin(), m_next.end());
+
+        // Merge with the last Step, only the Differences are reported
+        size_t changes = 0;
+        m_up.clear();
+        auto prev = m_links.begin();
+        auto next = m_next.begin();
+
+        while (prev != m_links.end() || next != m_next.end())
+        {
+            if (next == m_next.end() || (prev != m_links.end() && *prev < *next))
+            {
+                _apply(*prev++, false);
+                changes++;
+            }
+            else if (prev == m_links.end() || *next < *prev)
+            {
+                _apply(*next++, true);
+                changes++;
+            }
+            else
+            {
+                prev++;
+                next++;
+            }
+        }
+
+        m_links.swap(m_next);
+
+        if (changes > 0 && m_updateIcm)
+        {
+            ((m_icm != nullptr) ? m_icm : SatISLInterconTable::Get())->Commit();
+        }
+
+        // Wake waiting Devices once the new Links are visible in the ICM
+        for (const uint64_t link : m_up)
+        {
+            Ptr<SatelliteISLNetDevice> dev_a = m_channel->GetISLDevice(link >> 32);
+            Ptr<SatelliteISLNetDevice> dev_b = m_channel->GetISLDevice(link & 0xFFFFFFFF);
+
+            dev_a->NotifyLinkChange(Mac48Address::ConvertFrom(dev_b->GetAddress()));
+            dev_b->NotifyLinkChange(Mac48Address::ConvertFrom(dev_a->GetAddress()));
+        }
+
+        NS_LOG_INFO(m_links.size() << " Links, " << changes << " changed");
+
+        return changes;
+    }
+
+
+    size_t SatISLTopologyEngine::_occlusion(const size_t count)
+    {
+        m_ax.resize(count); m_ay.resize(count); m_az.resize(count);
+        m_bx.resize(count); m_by.resize(count); m_bz.resize(count);
+        m_visible.resize(count);
+
+        for (size_t k = 0; k < count; k++)
+        {
+            const Vector &a = m_positions[m_pairA[k]];
+            const Vector &b = m_positions[m_pairB[k]];
+            m_ax[k] = a.x; m_ay[k] = a.y; m_az[k] = a.z;
+            m_bx[k] = b.x; m_by[k] = b.y; m_bz[k] = b.z;
+        }
+
+        const double r = EARTH_RADIUS_EQ + m_grazingAltitude;
+        const double r_sq = r * r;
+
+        const double *ax = m_ax.data(), *ay = m_ay.data(), *az = m_az.data();
+        const double *bx = m_bx.data(), *by = m_by.data(), *bz = m_bz.data();
+        uint8_t *visible = m_visible.data();
+
+        // Closest Point of the Segment to the Earth Center, no Branches so the Loop vectorises
+        for (size_t k = 0; k < count; k++)
+        {
+            double dx = bx[k] - ax[k];
+            double dy = by[k] - ay[k];
+            double dz = bz[k] - az[k];
+
+            double dd = dx * dx + dy * dy + dz * dz;
+            double ad = ax[k] * dx + ay[k] * dy + az[k] * dz;
+
+            double t = std::min(std::max(-ad / std::max(dd, 1e-9), 0.0), 1.0);
+
+            double px = ax[k] + t * dx;
+            double py = ay[k] + t * dy;
+            double pz = az[k] + t * dz;
+
+            visible[k] = (px * px + py * py + pz * pz) >= r_sq;
+        }
+
+        size_t kept = 0;
+        for (size_t k = 0; k < count; k++)
+        {
+            m_pairA[kept] = m_pairA[k];
+            m_pairB[kept] = m_pairB[k];
+            kept += visible[k];
+        }
+
+        return kept;
+    }
+
+
+    bool SatISLTopologyEngine::_fieldOfView(const size_t a, const size_t b) const
+    {
+        Ptr<SatelliteISLNetDevice> dev_a = m_channel->GetISLDevice(a);
+        Ptr<SatelliteISLNetDevice> dev_b = m_channel->GetISLDevice(b);
+
+        bool seen = false;
+        for (size_t n = 0; n < dev_a->GetNTerminals() && !seen; n++)
+        {
+            seen = dev_a->GetISLTerminal(n)->IsInFieldOfView(m_positions[b]);
+        }
+
+        if (!seen) return false;
+
+        for (size_t n = 0; n < dev_b->GetNTerminals(); n++)
+        {
+            if (dev_b->GetISLTerminal(n)->IsInFieldOfView(m_positions[a])) return true;
+        }
+
+        return false;
+    }
+
+
+    void SatISLTopologyEngine::_apply(const uint64_t link, const bool up)
+    {
+        uint32_t a = link >> 32;
+        uint32_t b = link & 0xFFFFFFFF;
+
+        Ptr<SatelliteISLNetDevice> dev_a = m_channel->GetISLDevice(a);
+        Ptr<SatelliteISLNetDevice> dev_b = m_channel->GetISLDevice(b);
+
+        if (up)
+        {
+            m_linkUpTrace(dev_a, dev_b);
+            m_up.push_back(link);
+        }
+        else
+        {
+            m_linkDownTrace(dev_a, dev_b);
+        }
+
+        satid_t sat_a = m_satIds[a];
+        satid_t sat_b = m_satIds[b];
+        if (!m_updateIcm || sat_a == 0 || sat_b == 0 || sat_a == sat_b) return;
+
+        // Several Devices per Node: the ICM Link follows the first up and the last down Device Pair
+        uint64_t key = (sat_a < sat_b) ? _key(sat_a, sat_b) : _key(sat_b, sat_a);
+        Ptr<SatISLInterconTable> icm = (m_icm != nullptr) ? m_icm : SatISLInterconTable::Get();
+
+        if (up)
+        {
+            if (m_satLinks[key]++ > 0) return;
+
+            icm->Add(sat_a, sat_b);
+            icm->Add(sat_b, sat_a);
+        }
+        else
+        {
+            auto count = m_satLinks.find(key);
+            if (count == m_satLinks.end() || --count->second > 0) return;
+
+            m_satLinks.erase(count);
+            icm->Remove(sat_a, sat_b);
+            icm->Remove(sat_b, sat_a);
+        }
+    }
+
+
+    const std::vector<uint64_t>& SatISLTopologyEngine::GetLinks() const
+    {
+        return m_links;
+    }
+
+
+    bool SatISLTopologyEngine::IsLinked(const size_t a, const size_t b) const
+    {
+        if (a == b) return false;
+
+        uint64_t key = (a < b) ? _key(a, b) : _key(b, a);
+        return std::binary_search(m_links.begin(), m_links.end(), key);
+    }
+
+
+    uint64_t SatISLTopologyEngine::_key(const uint32_t a, const uint32_t b)
+    {
+        return ((uint64_t) a << 32) | b;
+    }
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,180 @@
+/**
+ * @brief   Visibility-based ISL Topology Engine
+ *
+ * @file    sat-isl-topology-engine.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ISL_TOPOLOGY_ENGINE_H
+#define SATELLITE_ISL_TOPOLOGY_ENGINE_H
+
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+
+#include "sat-isl-spatial-index.h"
+#include "sat-isl-intercon-table.h"
+
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+class SatelliteISLChannel;
+class SatelliteISLNetDevice;
+
+
+/**
+ * \ingroup satellite
+ *
+ * Once per Interval every feasible ISL between the Devices of a Channel is derived from
+ * the Geometry: the Line-of-Sight must clear the Earth plus the Grazing Altitude, the
+ * Distance must stay below the MaxRange and, optionally, each End must lie within the
+ * Aperture of a Terminal of the other End.
+ *
+ * Candidates come from a Range Query on the Spatial Index, so a Step costs O(N k) for k
+ * Neighbours in Range. The Occlusion Test runs branch-free over contiguous Arrays of the
+ * Candidate Pairs. The sorted Link Set of the Step is merged with the previous one, and
+ * only the Differences are reported (LinkUp / LinkDown Traces) and applied to the ICM.
+ * Both Devices of a new Link are notified, so Devices waiting for it resume at once.
+ *
+ * Links are tracked per Device Pair, the ICM per Satellite Pair: an ICM Link stays as long
+ * as at least one Device Pair of the two Satellites is linked.
+ *
+ * \brief Dynamic Topology of a SatelliteISLChannel
+ */
+class SatISLTopologyEngine : public Object
+{
+public:
+
+    /**
+     * @brief Signature of the LinkUp / LinkDown Traces
+     */
+    typedef void (*LinkTracedCallback)(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b);
+
+
+    static TypeId GetTypeId();
+
+    SatISLTopologyEngine();
+    ~SatISLTopologyEngine();
+
+
+    /**
+     * @brief Set the Channel whose Devices form the Topology
+     *
+     *        All Links of a previous Channel are reported down and removed from the ICM.
+     *
+     * @param channel
+     */
+    void SetChannel(Ptr<SatelliteISLChannel> channel);
+
+    /**
+     * @brief Set the ICM the Differences are applied to (with UpdateICM)
+     *
+     * @param icm       Target ICM, the global one if not set
+     */
+    void SetInterconTable(Ptr<SatISLInterconTable> icm);
+
+
+    /**
+     * @brief Evaluate the Topology now and then once per Interval
+     */
+    void Start();
+
+    void Stop();
+
+    /**
+     * @brief Evaluate the Topology once
+     *
+     * @return size_t   Number of changed Links
+     */
+    size_t Update();
+
+
+    /**
+     * @brief Get the undirected Links of the last Step
+     *
+     * @return const std::vector<uint64_t>&     (low, high) Device Indices of the Channel, packed and sorted
+     */
+    const std::vector<uint64_t>& GetLinks() const;
+
+    /**
+     * @brief Check if two Devices were linked in the last Step
+     */
+    bool IsLinked(const size_t a, const size_t b) const;
+
+
+protected:
+
+    void DoDispose() override;
+
+
+private:
+
+    /**
+     * @brief Periodic Step
+     */
+    void _step();
+
+    /**
+     * @brief Drop Candidate Pairs whose Line-of-Sight touches the Occlusion Sphere
+     *
+     * @return size_t   Number of remaining Pairs (compacted to the Front)
+     */
+    size_t _occlusion(const size_t count);
+
+    bool _fieldOfView(const size_t a, const size_t b) const;
+
+    void _apply(const uint64_t link, const bool up);
+
+    static uint64_t _key(const uint32_t a, const uint32_t b);
+
+
+    Ptr<SatelliteISLChannel> m_channel;
+    Ptr<SatISLInterconTable> m_icm;             //!< ICM receiving the Differences
+
+    Time m_interval;                            //!< Time Step of the Evaluation
+    double m_maxRange;                          //!< Max. Link Distance in m
+    double m_grazingAltitude;                   //!< Min. Altitude of the Line-of-Sight in m
+    bool m_checkFov;                            //!< Check the Terminal Apertures
+    bool m_updateIcm;                           //!< Apply the Differences to the ICM
+
+    EventId m_stepEvent;                        //!< Next periodic Step
+
+    SatelliteISLSpatialIndex m_index;           //!< Grid over the Device Positions
+    std::vector<Vector> m_positions;            //!< Position by Device Index
+    std::vector<satid_t> m_satIds;              //!< Satellite ID by Device Index, zero if untagged
+
+    std::vector<uint32_t> m_pairA;              //!< Candidate Pairs, first Device
+    std::vector<uint32_t> m_pairB;              //!< Candidate Pairs, second Device
+    std::vector<double> m_ax, m_ay, m_az;       //!< Candidate Pairs, first Position
+    std::vector<double> m_bx, m_by, m_bz;       //!< Candidate Pairs, second Position
+    std::vector<uint8_t> m_visible;             //!< Candidate Pairs, Line-of-Sight clears the Earth
+
+    std::vector<uint64_t> m_links;              //!< Sorted Links of the last Step
+    std::vector<uint64_t> m_next;               //!< Sorted Links of the current Step
+    std::vector<uint64_t> m_up;                 //!< Links which came up in the current Step
+
+    std::unordered_map<uint64_t, uint32_t> m_satLinks;     //!< Linked Device Pairs by (low, high) Satellite ID
+
+    TracedCallback<Ptr<SatelliteISLNetDevice>, Ptr<SatelliteISLNetDevice>> m_linkUpTrace;     //!< Link became feasible
+    TracedCallback<Ptr<SatelliteISLNetDevice>, Ptr<SatelliteISLNetDevice>> m_linkDownTrace;   //!< Link became infeasible
+
+};  /* SatISLTopologyEngine */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ISL_TOPOLOGY_ENGINE_H */
@@ -0,0 +1,47 @@
+/**
+ * @brief   Binary Orbital Elements of a Satellite
+ *
+ * @file    sat-orbital-elements.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_ORBITAL_ELEMENTS_H
+#define SATELLITE_ORBITAL_ELEMENTS_H
+
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * Mean Elements in full Precision, handed directly to the Mobility Models. A TLE is only
+ * formatted from them on Export (PseudoSatTLE), where the Angles are rounded to 4 Decimals.
+ *
+ * \brief Orbital Elements
+ */
+struct SatOrbitalElements
+{
+    int satNo = 0;                      //!< Satellite Catalog Number
+    int epochYear = 23;                 //!< Epoch Year (two Digits)
+    double epochDay = 79.89166667;      //!< Epoch Day of the Year incl. Fraction
+
+    double inclination = 30.0;          //!< Inclination in Degree
+    double raan = 0.0;                  //!< Right Ascension of the Ascending Node in Degree
+    double eccentricity = 0.0;          //!< Eccentricity
+    double perigee = -90.0;             //!< Argument of the Perigee in Degree
+    double meanAnomaly = 0.0;           //!< Mean Anomaly in Degree
+    double meanMotion = 15.0;           //!< Mean Motion in Revolutions per Day
+};
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_ORBITAL_ELEMENTS_H */
@@ -0,0 +1,118 @@
+/**
+ * @brief   Persistent Worker Threads
+ *
+ * @file    sat-worker-pool.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include "sat-worker-pool.h"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+
+
+namespace ns3
+{
+
+    SatWorkerPool::SatWorkerPool(const size_t workers)
+    : m_job(nullptr)
+    , m_tasks(0)
+    , m_generation(0)
+    , m_pending(0)
+    , m_stop(false)
+    {
+        for (size_t n = 0; n < workers; n++)
+        {
+            m_threads.emplace_back(&SatWorkerPool::_work, this, n + 1);
+        }
+    }
+
+
+    SatWorkerPool::~SatWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start.notify_all();
+
+        for (auto &thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+
+    size_t SatWorkerPool::GetNTasks() const
+    {
+        return m_threads.size() + 1;
+    }
+
+
+    void SatWorkerPool::Run(const size_t tasks, const Job &job)
+    {
+        NS_ASSERT_MSG(tasks <= GetNTasks(), "More Tasks than Threads");
+
+        if (tasks == 0) return;
+
+        if (tasks == 1)
+        {
+            job(0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = &job;
+            m_tasks = tasks;
+            m_pending = tasks - 1;
+            m_generation++;
+        }
+        m_start.notify_all();
+
+        job(0);
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        m_job = nullptr;
+    }
+
+
+    void SatWorkerPool::_work(const size_t idx)
+    {
+        uint64_t seen = 0;
+
+        while (true)
+        {
+            const Job *job = nullptr;
+            size_t tasks = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start.wait(lock, [this, seen]() { return m_stop || m_generation != seen; });
+                if (m_stop) return;
+
+                seen = m_generation;
+                job = m_job;
+                tasks = m_tasks;
+            }
+
+            if (idx < tasks)
+            {
+                (*job)(idx);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_pending == 0) m_done.notify_one();
+            }
+        }
+    }
+
+
+}   /* namespace ns3 */
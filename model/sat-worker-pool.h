@@ -0,0 +1,96 @@
+/**
+ * @brief   Persistent Worker Threads
+ *
+ * @file    sat-worker-pool.h
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#ifndef SATELLITE_WORKER_POOL_H
+#define SATELLITE_WORKER_POOL_H
+
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace ns3
+{
+
+/**
+ * \ingroup satellite
+ *
+ * The Threads are started once and sleep between two Runs, so a Pass per Time Step does not
+ * pay for the Thread Creation. The calling Thread works on the first Task, so a Pool of N
+ * Workers runs up to N+1 Tasks at once.
+ *
+ * \brief Persistent Worker Threads for parallel Passes
+ */
+class SatWorkerPool
+{
+public:
+
+    typedef std::function<void(size_t)> Job;       //!< Called with the Task Index
+
+
+    /**
+     * @brief Start the Worker Threads
+     *
+     * @param workers   Number of Threads besides the calling one
+     */
+    SatWorkerPool(const size_t workers);
+    ~SatWorkerPool();
+
+    SatWorkerPool(const SatWorkerPool&) = delete;
+    SatWorkerPool& operator=(const SatWorkerPool&) = delete;
+
+
+    /**
+     * @brief Get the Max. Number of Tasks of one Run, the Workers and the calling Thread
+     *
+     * @return size_t
+     */
+    size_t GetNTasks() const;
+
+    /**
+     * @brief Run the Job once per Task Index and wait for all Tasks
+     *
+     * @param tasks     Number of Tasks, at most GetNTasks()
+     * @param job       Job, Task 0 runs on the calling Thread
+     */
+    void Run(const size_t tasks, const Job &job);
+
+
+private:
+
+    void _work(const size_t idx);
+
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+
+    const Job *m_job;                   //!< Job of the current Run
+    size_t m_tasks;                     //!< Tasks of the current Run
+    uint64_t m_generation;              //!< Counter of the Runs
+    size_t m_pending;                   //!< Unfinished Tasks on the Workers
+    bool m_stop;                        //!< Workers shall exit
+
+};  /* SatWorkerPool */
+
+
+};  /* namespace ns3 */
+
+
+#endif /* SATELLITE_WORKER_POOL_H */
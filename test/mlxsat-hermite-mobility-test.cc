@@ -0,0 +1,203 @@
+/**
+ * @brief   Tests of the cubic Hermite Ephemeris Mobility Model
+ *
+ * @file    mlxsat-hermite-mobility-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/sat-circular-orbit-mobility-model.h>
+#include <ns3/sat-hermite-mobility-model.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <random>
+
+
+NS_LOG_COMPONENT_DEFINE("HermiteMobilityTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Sampled circular Orbit against the Reference, at the Samples and in between
+ */
+class HermiteReferenceTestCase : public TestCase
+{
+
+public:
+    HermiteReferenceTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+HermiteReferenceTestCase::HermiteReferenceTestCase()
+: TestCase("hermite-reference")
+{
+}
+
+
+void HermiteReferenceTestCase::DoRun()
+{
+    const double tolerance = 0.5;
+    const Time span = Seconds(3600);
+
+    Ptr<SatCircularOrbitMobilityModel> reference = CreateObjectWithAttributes<SatCircularOrbitMobilityModel>(
+        "Inclination", DoubleValue(53.0),
+        "AscendingNode", DoubleValue(40.0),
+        "LatitudeArgument", DoubleValue(10.0),
+        "MeanMotion", DoubleValue(15.2)
+    );
+
+    // The coarse Interval misses the Tolerance and must be refined
+    Ptr<SatHermiteMobilityModel> hermite = CreateObjectWithAttributes<SatHermiteMobilityModel>(
+        "SampleInterval", TimeValue(Seconds(240)),
+        "Span", TimeValue(span),
+        "Tolerance", DoubleValue(tolerance)
+    );
+    hermite->SetReference(reference);
+
+    const Time step = hermite->GetEffectiveInterval();
+    NS_TEST_ASSERT_MSG_LT(step, Seconds(240), "Interval not refined");
+    NS_TEST_ASSERT_MSG_EQ(hermite->GetSampleCount(), (size_t) (span.GetTimeStep() / step.GetTimeStep() + 2), "Wrong Number of Samples");
+    NS_TEST_ASSERT_MSG_LT_OR_EQ(hermite->GetMaxError(), tolerance, "Midpoint Error above the Tolerance");
+    NS_TEST_ASSERT_MSG_GT(hermite->GetMaxError(), 0.0, "No Midpoint Error measured");
+
+    Vector pos, vel, ref_pos, ref_vel;
+
+    // The Samples are exact
+    for (int64_t k = 0; TimeStep(step.GetTimeStep() * k) <= span; k += 7)
+    {
+        hermite->GetStateAt(TimeStep(step.GetTimeStep() * k), pos, vel);
+        reference->GetStateAt(TimeStep(step.GetTimeStep() * k), ref_pos, ref_vel);
+        NS_TEST_ASSERT_MSG_LT(CalculateDistance(pos, ref_pos), 1e-3, "Sample " << k << " deviates");
+    }
+
+    // Between the Samples the Error stays within the Tolerance
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> offset(0.0, span.GetSeconds());
+    double vel_error = 0.0;
+
+    for (int n = 0; n < 2000; n++)
+    {
+        Time t = Seconds(offset(rng));
+
+        hermite->GetStateAt(t, pos, vel);
+        reference->GetStateAt(t, ref_pos, ref_vel);
+
+        NS_TEST_ASSERT_MSG_LT_OR_EQ(CalculateDistance(pos, ref_pos), tolerance, "Position Error at " << t.As(Time::S));
+        vel_error = std::max(vel_error, CalculateDistance(vel, ref_vel));
+    }
+
+    // The Velocity is the Derivative of the Interpolant, its Error scales with the Position Error over the Step
+    NS_TEST_ASSERT_MSG_LT(vel_error, 10.0 * tolerance / step.GetSeconds(), "Velocity Error of the Interpolant");
+
+    // Beyond the Span the Reference is evaluated directly
+    hermite->GetStateAt(span + Seconds(1234), pos, vel);
+    reference->GetStateAt(span + Seconds(1234), ref_pos, ref_vel);
+    NS_TEST_ASSERT_MSG_EQ_TOL(CalculateDistance(pos, ref_pos), 0.0, 1e-9, "Reference not used beyond the Span");
+
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Samples added one by one: exact for cubic Motion, linear Extrapolation outside
+ */
+class HermiteSeriesTestCase : public TestCase
+{
+
+public:
+    HermiteSeriesTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+HermiteSeriesTestCase::HermiteSeriesTestCase()
+: TestCase("hermite-series")
+{
+}
+
+
+void HermiteSeriesTestCase::DoRun()
+{
+    const double h = 10.0;
+
+    Ptr<SatHermiteMobilityModel> hermite = CreateObjectWithAttributes<SatHermiteMobilityModel>(
+        "SampleInterval", TimeValue(Seconds(h))
+    );
+    hermite->SetStart(Seconds(100));
+
+    // Cubic Motion along x, the Hermite Interpolant reproduces it
+    auto x = [](const double t) { return 7000e3 + 50.0 * t - 0.3 * t * t + 0.002 * t * t * t; };
+    auto v = [](const double t) { return 50.0 - 0.6 * t + 0.006 * t * t; };
+
+    for (int k = 0; k < 6; k++)
+    {
+        hermite->AddSample(Vector(x(k * h), 1.0, 2.0), Vector(v(k * h), 0.0, 0.0));
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(hermite->GetSampleCount(), 6, "Wrong Number of Samples");
+    NS_TEST_ASSERT_MSG_EQ(hermite->GetMaxError(), 0.0, "Error without Reference");
+
+    Vector pos, vel;
+    for (double t = 0.0; t < 5 * h; t += 1.7)
+    {
+        hermite->GetStateAt(Seconds(100 + t), pos, vel);
+        NS_TEST_ASSERT_MSG_EQ_TOL(pos.x, x(t), 1e-6, "Position at " << t << " s");
+        NS_TEST_ASSERT_MSG_EQ_TOL(vel.x, v(t), 1e-6, "Velocity at " << t << " s");
+        NS_TEST_ASSERT_MSG_EQ_TOL(pos.y, 1.0, 1e-9, "Constant Component changed at " << t << " s");
+    }
+
+    // Before the first and after the last Sample the outermost one moves along its Velocity
+    hermite->GetStateAt(Seconds(90), pos, vel);
+    NS_TEST_ASSERT_MSG_EQ_TOL(pos.x, x(0) - 10.0 * v(0), 1e-6, "Extrapolation before the Series");
+
+    hermite->GetStateAt(Seconds(100 + 5 * h + 20), pos, vel);
+    NS_TEST_ASSERT_MSG_EQ_TOL(pos.x, x(5 * h) + 20.0 * v(5 * h), 1e-6, "Extrapolation after the Series");
+    NS_TEST_ASSERT_MSG_EQ_TOL(vel.x, v(5 * h), 1e-9, "Velocity of the Extrapolation");
+
+    Simulator::Destroy();
+}
+
+
+
+class HermiteMobilityTestSuite : public TestSuite
+{
+public:
+    HermiteMobilityTestSuite();
+
+};
+
+
+HermiteMobilityTestSuite::HermiteMobilityTestSuite()
+: TestSuite("hermite-mobility-test", UNIT)
+{
+
+    AddTestCase(new HermiteReferenceTestCase(), TestCase::QUICK);
+    AddTestCase(new HermiteSeriesTestCase(), TestCase::QUICK);
+
+}
+
+static HermiteMobilityTestSuite g_HermiteMobilityTestSuiteInstance;
+
+
+}   /* namespace ns3 */
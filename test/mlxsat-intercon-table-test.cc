@@ -0,0 +1,212 @@
+/**
+ * @brief   Tests of the Interconnect Matrix Snapshots
+ *
+ * @file    mlxsat-intercon-table-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/sat-isl-intercon-table.h>
+#include <ns3/sat-node-tag.h>
+#include <ns3/test.h>
+
+
+NS_LOG_COMPONENT_DEFINE("InterconTableTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Register Satellites in the Registry of the current Simulation, the ICM checks their IDs
+ */
+static void
+RegisterSatellites(const size_t N)
+{
+    for (size_t n = 0; n < N; n++)
+    {
+        CreateObject<SatelliteNodeTag>()->Register();
+    }
+}
+
+
+/**
+ * @brief CSR Rows and Membership, with and without the Bitset Matrix
+ */
+class InterconTableCsrTestCase : public TestCase
+{
+
+public:
+    InterconTableCsrTestCase(const uint64_t bitsetLimit);
+
+
+private:
+
+    virtual void DoRun();
+
+    uint64_t m_bitsetLimit;
+
+};
+
+
+InterconTableCsrTestCase::InterconTableCsrTestCase(const uint64_t bitsetLimit)
+: TestCase(bitsetLimit > 0 ? "csr-bitset" : "csr-search")
+, m_bitsetLimit(bitsetLimit)
+{
+}
+
+
+void InterconTableCsrTestCase::DoRun()
+{
+    RegisterSatellites(8);
+
+    Ptr<SatISLInterconTable> icm = CreateObjectWithAttributes<SatISLInterconTable>("BitsetLimit", UintegerValue(m_bitsetLimit));
+
+    // Unsorted and duplicate Adds, the Rows have to end up sorted and unique
+    icm->Add(3, 7);
+    icm->Add(3, 1);
+    icm->Add(3, 5);
+    icm->Add(3, 1);
+    icm->Add(1, 2);
+    icm->Add(8, 1);
+    icm->Commit(Seconds(0));
+
+    Ptr<const SatISLInterconTable::Snapshot> snap = icm->GetSnapshot(Seconds(0));
+    NS_TEST_ASSERT_MSG_NE(snap, nullptr, "No Snapshot after the Commit");
+    NS_TEST_ASSERT_MSG_EQ(snap->maxId, 8, "Wrong max. ID");
+    NS_TEST_ASSERT_MSG_EQ(snap->offsets.size(), 10, "Wrong Number of Row Offsets");
+    NS_TEST_ASSERT_MSG_EQ(snap->targets.size(), 5, "Wrong Number of Links");
+    NS_TEST_ASSERT_MSG_EQ(snap->bits.empty(), m_bitsetLimit == 0, "Bitset against the Limit");
+
+    SatISLInterconTable::NeighbourRange row = icm->GetKnownNeighbours(3);
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 3, "Wrong Row Size");
+    NS_TEST_ASSERT_MSG_EQ(row.first[0], 1, "Row not sorted");
+    NS_TEST_ASSERT_MSG_EQ(row.first[1], 5, "Row not sorted");
+    NS_TEST_ASSERT_MSG_EQ(row.first[2], 7, "Row not sorted");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetKnownNeighbours(4).size(), 0, "Empty Row has Neighbours");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetKnownNeighbours(42).size(), 0, "Unknown ID has Neighbours");
+
+    // Membership against the Rows, Links are directed
+    for (satid_t src = 0; src <= 9; src++)
+    {
+        for (satid_t dst = 0; dst <= 9; dst++)
+        {
+            bool expected = (src == 3 && (dst == 1 || dst == 5 || dst == 7))
+                         || (src == 1 && dst == 2)
+                         || (src == 8 && dst == 1);
+
+            NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(src, dst), expected, "Membership of " << src << " -> " << dst);
+        }
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(icm->GetSize(), 5, "Wrong Number of Links now");
+
+    icm->Dispose();
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Epochs committed ahead of Time, direct Edits and the Lifetime of a Neighbour Range
+ */
+class InterconTableEpochTestCase : public TestCase
+{
+
+public:
+    InterconTableEpochTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+InterconTableEpochTestCase::InterconTableEpochTestCase()
+: TestCase("epochs")
+{
+}
+
+
+void InterconTableEpochTestCase::DoRun()
+{
+    RegisterSatellites(6);
+
+    Ptr<SatISLInterconTable> icm = CreateObject<SatISLInterconTable>();
+
+    NS_TEST_ASSERT_MSG_EQ(icm->GetSnapshot(Seconds(0)), nullptr, "Snapshot before the first Commit");
+
+    icm->Add(1, 2);
+    icm->Add(2, 3);
+    uint64_t v1 = icm->Commit(Seconds(0));
+
+    icm->Add(3, 4);
+    uint64_t v2 = icm->Commit(Seconds(10));
+
+    NS_TEST_ASSERT_MSG_GT(v2, v1, "Versions do not increase");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetSnapshot(Seconds(5))->version, v1, "Wrong Snapshot within the first Epoch");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetSnapshot(Seconds(10))->version, v2, "Wrong Snapshot at the second Epoch");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetNextChange(Seconds(0)), Seconds(10), "Wrong next Change");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetNextChange(Seconds(10)), Time::Max(), "Change after the last Epoch");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(3, 4), false, "Future Link available now");
+
+    // A direct Edit takes Effect now, also in the Epoch committed ahead of Time
+    icm->Remove(1, 2);
+    icm->Add(5, 6);
+
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(1, 2), false, "Direct Remove not effective now");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(5, 6), true, "Direct Add not effective now");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(2, 3), true, "Direct Edit dropped a Link");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(3, 4), false, "Direct Edit pulled a future Link forward");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(1, 2, Seconds(10)), false, "Direct Remove lost in the future Epoch");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(5, 6, Seconds(10)), true, "Direct Add lost in the future Epoch");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(3, 4, Seconds(10)), true, "Future Link lost");
+    NS_TEST_ASSERT_MSG_GT(icm->GetSnapshot(Seconds(0))->version, v2, "Edited Epoch kept its Version");
+
+    // A Range keeps its Snapshot alive when a Commit of the same Epoch replaces it
+    SatISLInterconTable::NeighbourRange row = icm->GetKnownNeighbours(2);
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 1, "Wrong Row Size");
+
+    icm->Add(2, 5);
+    icm->GetSnapshot(Seconds(0));
+
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 1, "Range changed with the Snapshot");
+    NS_TEST_ASSERT_MSG_EQ(*row.begin(), 3, "Range lost its Row");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetKnownNeighbours(2).size(), 2, "New Range misses the Edit");
+
+    icm->Dispose();
+    Simulator::Destroy();
+}
+
+
+
+class InterconTableTestSuite : public TestSuite
+{
+public:
+    InterconTableTestSuite();
+
+};
+
+
+InterconTableTestSuite::InterconTableTestSuite()
+: TestSuite("intercon-table-test", UNIT)
+{
+
+    AddTestCase(new InterconTableCsrTestCase(16 * 1024 * 1024), TestCase::QUICK);
+    AddTestCase(new InterconTableCsrTestCase(0), TestCase::QUICK);
+    AddTestCase(new InterconTableEpochTestCase(), TestCase::QUICK);
+
+}
+
+static InterconTableTestSuite g_InterconTableTestSuiteInstance;
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,397 @@
+/**
+ * @brief   Tests of the incremental Shortest-Path Repair of the Global Routing
+ *
+ * @file    mlxsat-isl-global-routing-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/internet-stack-helper.h>
+#include <ns3/ipv4-address-helper.h>
+#include <ns3/ipv4-routing-helper.h>
+#include <ns3/node-container.h>
+#include <ns3/sat-isl-channel.h>
+#include <ns3/sat-isl-global-routing.h>
+#include <ns3/sat-isl-intercon-table.h>
+#include <ns3/sat-isl-interface-helper.h>
+#include <ns3/sat-isl-ipv4-routing.h>
+#include <ns3/sat-isl-net-device.h>
+#include <ns3/sat-node-tag.h>
+#include <ns3/test.h>
+
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+
+NS_LOG_COMPONENT_DEFINE("ISLGlobalRoutingTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Routing Protocol with the Lookup exposed to the Test
+ */
+class GlobalRoutingLookUpProbe : public SatelliteISLRoutingIPv4
+{
+
+public:
+    using SatelliteISLRoutingIPv4::LookUp;
+
+};
+
+
+/**
+ * @brief Install the Lookup Probe as Routing Protocol
+ */
+class GlobalRoutingProbeHelper : public Ipv4RoutingHelper
+{
+
+public:
+    GlobalRoutingProbeHelper *Copy() const override
+    {
+        return new GlobalRoutingProbeHelper(*this);
+    }
+
+    Ptr<Ipv4RoutingProtocol> Create(Ptr<Node> node) const override
+    {
+        return CreateObject<GlobalRoutingLookUpProbe>();
+    }
+
+};
+
+
+/**
+ * @brief Random Batches of LinkUp / LinkDown against a fresh Computation for every Source
+ *
+ *        The repaired Trees must have the Path Weights of a full Dijkstra, and the installed
+ *        Routes (with Multipath the equal-cost Sets) must match the repaired Trees.
+ */
+class ISLGlobalRoutingRepairTestCase : public TestCase
+{
+
+public:
+    ISLGlobalRoutingRepairTestCase(const bool multipath);
+
+
+private:
+
+    virtual void DoRun();
+
+    /**
+     * @brief Change a Link in the ICM of the Reference and in the incremental Routing
+     */
+    void Change(const uint32_t a, const uint32_t b, const bool up);
+
+    /**
+     * @brief Compare the incremental Routing with its installed Routes and the Reference
+     */
+    void Check(const std::string &batch);
+
+    bool m_multipath;
+
+    NodeContainer m_nodes;
+    std::vector<Ptr<SatelliteISLNetDevice>> m_devices;
+    std::vector<uint32_t> m_index;                          //!< Channel Device Index by Node
+    std::vector<uint32_t> m_nodeByIndex;                    //!< Node by Channel Device Index
+    std::vector<Ipv4Address> m_addresses;                   //!< ISL Address by Node
+    std::set<std::pair<uint32_t, uint32_t>> m_links;        //!< Links (a < b) by Node
+
+    Ptr<SatISLInterconTable> m_icm;
+    Ptr<SatISLGlobalRouting> m_routing;                     //!< Incremental Routing under Test
+    Ptr<SatISLGlobalRouting> m_reference;                   //!< Full Computation on the same Links
+
+};
+
+
+ISLGlobalRoutingRepairTestCase::ISLGlobalRoutingRepairTestCase(const bool multipath)
+: TestCase(multipath ? "repair-multipath" : "repair")
+, m_multipath(multipath)
+{
+}
+
+
+void ISLGlobalRoutingRepairTestCase::Change(const uint32_t a, const uint32_t b, const bool up)
+{
+    satid_t sa = m_nodes.Get(a)->GetObject<SatelliteNodeTag>()->GetId();
+    satid_t sb = m_nodes.Get(b)->GetObject<SatelliteNodeTag>()->GetId();
+
+    if (up)
+    {
+        m_icm->Add(sa, sb);
+        m_icm->Add(sb, sa);
+        m_routing->LinkUp(m_devices[a], m_devices[b]);
+        m_links.insert({std::min(a, b), std::max(a, b)});
+    }
+    else
+    {
+        m_icm->Remove(sa, sb);
+        m_icm->Remove(sb, sa);
+        m_routing->LinkDown(m_devices[a], m_devices[b]);
+        m_links.erase(std::make_pair(std::min(a, b), std::max(a, b)));
+    }
+}
+
+
+void ISLGlobalRoutingRepairTestCase::Check(const std::string &batch)
+{
+    const uint32_t N = m_nodes.GetN();
+    const double tolerance = 0.05;
+
+    auto weight = [this](const uint32_t a, const uint32_t b) {
+        Vector pa = m_nodes.Get(a)->GetObject<MobilityModel>()->GetPosition();
+        Vector pb = m_nodes.Get(b)->GetObject<MobilityModel>()->GetPosition();
+        return CalculateDistance(pa, pb) / 299792458.0;
+    };
+
+    std::map<uint32_t, uint32_t> byAddress;                 // Node by ISL Address
+    for (uint32_t n = 0; n < N; n++)
+    {
+        byAddress[m_addresses[n].Get()] = n;
+    }
+
+    // Installed Routes against the repaired Trees, before the Reference reinstalls them
+    for (uint32_t s = 0; s < N; s++)
+    {
+        Ptr<GlobalRoutingLookUpProbe> probe = DynamicCast<GlobalRoutingLookUpProbe>(m_nodes.Get(s)->GetObject<Ipv4>()->GetRoutingProtocol());
+        NS_TEST_ASSERT_MSG_NE(probe, nullptr, "Probe not installed on Node " << s);
+
+        for (uint32_t d = 0; d < N; d++)
+        {
+            if (d == s) continue;
+
+            double dist = m_routing->GetDistance(m_index[s], m_index[d]);
+            std::set<uint32_t> expected;
+
+            if (!std::isinf(dist))
+            {
+                uint32_t primary = m_routing->GetNextHop(m_index[s], m_index[d]);
+                NS_TEST_ASSERT_MSG_NE(primary, SatISLGlobalRouting::NO_HOP, batch << ": no First Hop " << s << " -> " << d);
+                expected.insert(byAddress[m_addresses[m_nodeByIndex[primary]].Get()]);
+
+                for (uint32_t n = 0; m_multipath && n < N; n++)
+                {
+                    if (n == s || !m_links.count({std::min(s, n), std::max(s, n)})) continue;
+
+                    double rest = m_routing->GetDistance(m_index[n], m_index[d]);
+                    if (rest < dist && weight(s, n) + rest <= dist * (1.0 + tolerance)) expected.insert(n);
+                }
+            }
+
+            // Every Flow Hash modulo the Number of Next Hops, so N Flows reach all of them
+            std::set<uint32_t> installed;
+            for (uint32_t flow = 0; flow < N; flow++)
+            {
+                Ptr<Ipv4Route> route = probe->LookUp(m_addresses[d], nullptr, flow);
+                if (route == nullptr) break;
+
+                auto it = byAddress.find(route->GetGateway().Get());
+                NS_TEST_ASSERT_MSG_EQ((it != byAddress.end()), true, batch << ": unknown Gateway " << route->GetGateway());
+                installed.insert(it->second);
+            }
+
+            NS_TEST_ASSERT_MSG_EQ((installed == expected), true, batch << ": Next Hops of " << s << " -> " << d << " (" << installed.size() << " installed, " << expected.size() << " expected)");
+        }
+    }
+
+    m_reference->Update();
+
+    for (uint32_t s = 0; s < N; s++)
+    {
+        for (uint32_t d = 0; d < N; d++)
+        {
+            double got = m_routing->GetDistance(m_index[s], m_index[d]);
+            double want = m_reference->GetDistance(m_index[s], m_index[d]);
+
+            NS_TEST_ASSERT_MSG_EQ(std::isinf(got), std::isinf(want), batch << ": Reachability of " << s << " -> " << d);
+            if (std::isinf(want)) continue;
+
+            NS_TEST_ASSERT_MSG_EQ_TOL(got, want, 1e-12, batch << ": Path Weight of " << s << " -> " << d);
+
+            // The First Hop lies on a shortest Path
+            if (s == d) continue;
+            uint32_t hop = m_routing->GetNextHop(m_index[s], m_index[d]);
+            double via = m_reference->GetDistance(m_index[s], hop) + m_reference->GetDistance(hop, m_index[d]);
+            NS_TEST_ASSERT_MSG_EQ_TOL(via, want, 1e-12, batch << ": First Hop of " << s << " -> " << d << " off the shortest Paths");
+        }
+    }
+}
+
+
+void ISLGlobalRoutingRepairTestCase::DoRun()
+{
+    const uint32_t N = 30;
+    std::mt19937 rng(m_multipath ? 7 : 3);
+    std::uniform_real_distribution<double> coordinate(-7000e3, 7000e3);
+
+    m_nodes.Create(N);
+    for (uint32_t n = 0; n < N; n++)
+    {
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        mob->SetPosition(Vector(coordinate(rng), coordinate(rng), coordinate(rng)));
+        m_nodes.Get(n)->AggregateObject(mob);
+
+        Ptr<SatelliteNodeTag> tag = CreateObject<SatelliteNodeTag>();
+        m_nodes.Get(n)->AggregateObject(tag);
+        tag->Register();
+    }
+
+    Ptr<SatelliteISLChannel> channel = CreateObject<SatelliteISLChannel>();
+    NetDeviceContainer devices = SatelliteISLInterfaceHelper().Install(m_nodes, channel);
+
+    InternetStackHelper internet;
+    internet.SetRoutingHelper(GlobalRoutingProbeHelper());
+    internet.Install(m_nodes);
+
+    Ipv4AddressHelper addresses;
+    addresses.SetBase("10.0.0.0", "255.255.0.0");
+    Ipv4InterfaceContainer interfaces = addresses.Assign(devices);
+
+    m_nodeByIndex.resize(N);
+    for (uint32_t n = 0; n < N; n++)
+    {
+        m_devices.push_back(DynamicCast<SatelliteISLNetDevice>(devices.Get(n)));
+        m_index.push_back(channel->GetDeviceIndex(Mac48Address::ConvertFrom(devices.Get(n)->GetAddress())));
+        m_addresses.push_back(interfaces.GetAddress(n));
+        m_nodeByIndex[m_index[n]] = n;
+    }
+
+    m_icm = CreateObject<SatISLInterconTable>();
+
+    m_routing = CreateObjectWithAttributes<SatISLGlobalRouting>(
+        "Incremental", BooleanValue(true),
+        "Threads", UintegerValue(2),
+        "Multipath", BooleanValue(m_multipath)
+    );
+    m_routing->SetChannel(channel);
+    m_routing->SetInterconTable(m_icm);
+
+    m_reference = CreateObjectWithAttributes<SatISLGlobalRouting>(
+        "Incremental", BooleanValue(false),
+        "Threads", UintegerValue(1),
+        "Multipath", BooleanValue(m_multipath)
+    );
+    m_reference->SetChannel(channel);
+    m_reference->SetInterconTable(m_icm);
+
+    // Initial Graph: a Ring with random Chords, only in the ICM
+    auto link = [this](const uint32_t a, const uint32_t b) {
+        satid_t sa = m_nodes.Get(a)->GetObject<SatelliteNodeTag>()->GetId();
+        satid_t sb = m_nodes.Get(b)->GetObject<SatelliteNodeTag>()->GetId();
+
+        m_icm->Add(sa, sb);
+        m_icm->Add(sb, sa);
+        m_links.insert({std::min(a, b), std::max(a, b)});
+    };
+
+    for (uint32_t n = 0; n < N; n++)
+    {
+        link(n, (n + 1) % N);
+    }
+
+    for (uint32_t k = 0; k < N; k++)
+    {
+        uint32_t a = rng() % N;
+        uint32_t b = rng() % N;
+        if (a != b) link(a, b);
+    }
+
+    m_routing->Update();
+    Check("initial");
+
+    // First Batch: remove the first Edge of a multi-Hop Path of Node 0 (a Tree Edge) and add a Shortcut to its End
+    uint32_t target = N;
+    uint32_t first = N;
+    for (uint32_t d = 1; d < N && target == N; d++)
+    {
+        uint32_t hop = m_routing->GetNextHop(m_index[0], m_index[d]);
+        if (hop == SatISLGlobalRouting::NO_HOP || hop == m_index[d] || m_links.count({0, d})) continue;
+
+        target = d;
+        first = m_nodeByIndex[hop];
+    }
+
+    NS_TEST_ASSERT_MSG_NE(target, N, "No multi-Hop Destination of Node 0");
+
+    Change(0, first, false);
+    Change(0, target, true);
+    Simulator::Stop(Seconds(0));
+    Simulator::Run();
+    Check("tree-edge-and-shortcut");
+
+    // Random Batches of removed existing and added new Links
+    for (int batch = 0; batch < 15; batch++)
+    {
+        size_t removes = 1 + rng() % 4;
+        for (size_t k = 0; k < removes && !m_links.empty(); k++)
+        {
+            auto it = m_links.begin();
+            std::advance(it, rng() % m_links.size());
+            Change(it->first, it->second, false);
+        }
+
+        size_t adds = 1 + rng() % 4;
+        for (size_t k = 0; k < adds; k++)
+        {
+            uint32_t a = rng() % N;
+            uint32_t b = rng() % N;
+            if (a == b || m_links.count({std::min(a, b), std::max(a, b)})) continue;
+
+            Change(a, b, true);
+        }
+
+        Simulator::Stop(Seconds(0));
+        Simulator::Run();
+        Check("batch " + std::to_string(batch));
+    }
+
+    m_routing->Dispose();
+    m_reference->Dispose();
+    m_icm->Dispose();
+    m_routing = nullptr;
+    m_reference = nullptr;
+    m_icm = nullptr;
+    m_devices.clear();
+    m_index.clear();
+    m_nodeByIndex.clear();
+    m_addresses.clear();
+    m_links.clear();
+    m_nodes = NodeContainer();
+    Simulator::Destroy();
+}
+
+
+
+class ISLGlobalRoutingTestSuite : public TestSuite
+{
+public:
+    ISLGlobalRoutingTestSuite();
+
+};
+
+
+ISLGlobalRoutingTestSuite::ISLGlobalRoutingTestSuite()
+: TestSuite("isl-global-routing-test", UNIT)
+{
+
+    AddTestCase(new ISLGlobalRoutingRepairTestCase(false), TestCase::QUICK);
+    AddTestCase(new ISLGlobalRoutingRepairTestCase(true), TestCase::QUICK);
+
+}
+
+static ISLGlobalRoutingTestSuite g_ISLGlobalRoutingTestSuiteInstance;
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,254 @@
+/**
+ * @brief   Tests of the +Grid Builder
+ *
+ * @file    mlxsat-isl-grid-helper-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/mobility-model.h>
+#include <ns3/sat-isl-grid-helper.h>
+#include <ns3/sat-isl-intercon-table.h>
+#include <ns3/sat-node-registry.h>
+#include <ns3/walker-constellation-helper.h>
+#include <ns3/test.h>
+
+#include <cmath>
+
+
+NS_LOG_COMPONENT_DEFINE("ISLGridHelperTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Create and initialize a Walker Constellation with analytic Orbits
+ */
+static Ptr<WalkerConstellationHelper>
+CreateConstellation(const WalkerConstellationHelper::walkerConstellationType_t type, const int planes, const int sats, const double inclination)
+{
+    Ptr<WalkerConstellationHelper> constellation = CreateObjectWithAttributes<WalkerConstellationHelper>(
+        "WalkerType", EnumValue(type),
+        "Inclination", DoubleValue(inclination),
+        "NumOfOrbits", IntegerValue(planes),
+        "SatsPerOrbit", IntegerValue(sats),
+        "Phasing", DoubleValue(360.0 / (planes * sats)),
+        "MobilityModel", EnumValue(WalkerOrbitHelper::MOBILITY_CIRCULAR)
+    );
+    constellation->Initialize();
+
+    return constellation;
+}
+
+
+/**
+ * @brief Static +Grid: Degree, Symmetry, Plane Neighbours and the Seam
+ */
+class ISLGridTopologyTestCase : public TestCase
+{
+
+public:
+    ISLGridTopologyTestCase(const WalkerConstellationHelper::walkerConstellationType_t type);
+
+
+private:
+
+    virtual void DoRun();
+
+    WalkerConstellationHelper::walkerConstellationType_t m_type;
+
+};
+
+
+ISLGridTopologyTestCase::ISLGridTopologyTestCase(const WalkerConstellationHelper::walkerConstellationType_t type)
+: TestCase(type == WalkerConstellationHelper::WALKER_DELTA ? "grid-delta" : "grid-star")
+, m_type(type)
+{
+}
+
+
+void ISLGridTopologyTestCase::DoRun()
+{
+    const int planes = 4;
+    const int sats = 6;
+    const bool closed = (m_type == WalkerConstellationHelper::WALKER_DELTA);
+
+    Ptr<WalkerConstellationHelper> constellation = CreateConstellation(m_type, planes, sats, 53.0);
+    Ptr<SatISLInterconTable> icm = CreateObject<SatISLInterconTable>();
+    Ptr<SatISLGridHelper> grid = CreateObject<SatISLGridHelper>();
+
+    // Plane Links in every Plane, Cross-Plane Links between all adjacent Planes (one Pair less at an open Seam)
+    size_t expected = 2 * planes * sats + 2 * (closed ? planes : planes - 1) * sats;
+    NS_TEST_ASSERT_MSG_EQ(grid->Install(constellation, icm), expected, "Wrong Number of Links");
+    NS_TEST_ASSERT_MSG_EQ(icm->GetSize(), expected, "ICM differs from the reported Links");
+
+    Ptr<SatelliteRegistry> registry = SatelliteRegistry::Get();
+
+    for (int p = 0; p < planes; p++)
+    {
+        NodeContainer nodes = constellation->getOrbit(p)->getSatellites();
+        bool edge = !closed && (p == 0 || p == planes - 1);
+
+        for (int s = 0; s < sats; s++)
+        {
+            satid_t id = nodes.Get(s)->GetObject<SatelliteNodeTag>()->GetId();
+            satid_t fore = nodes.Get((s + 1) % sats)->GetObject<SatelliteNodeTag>()->GetId();
+            satid_t aft = nodes.Get((s + sats - 1) % sats)->GetObject<SatelliteNodeTag>()->GetId();
+
+            SatISLInterconTable::NeighbourRange row = icm->GetKnownNeighbours(id);
+            NS_TEST_ASSERT_MSG_EQ(row.size(), (size_t) (edge ? 3 : 4), "Wrong Degree of Satellite " << id);
+
+            NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(id, fore), true, "Missing fore Link of " << id);
+            NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(id, aft), true, "Missing aft Link of " << id);
+
+            size_t cross = 0;
+            for (const satid_t other : row)
+            {
+                NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(other, id), true, "Link " << id << " -> " << other << " is not symmetric");
+                if (registry->GetTag(other)->GetOID() != registry->GetTag(id)->GetOID()) cross++;
+            }
+
+            NS_TEST_ASSERT_MSG_EQ(cross, (size_t) (edge ? 1 : 2), "Wrong Number of Cross-Plane Links of " << id);
+        }
+    }
+
+    grid->Dispose();
+    icm->Dispose();
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Cross-Plane Links follow the Polar Threshold while the Satellites move
+ */
+class ISLGridPolarTestCase : public TestCase
+{
+
+public:
+    ISLGridPolarTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+    /**
+     * @brief Compare the Cross-Plane Links with the Latitudes of both Ends
+     */
+    void Check();
+
+    Ptr<WalkerConstellationHelper> m_constellation;
+    Ptr<SatISLInterconTable> m_icm;                 //!< +Grid with Polar Shutdown
+    Ptr<SatISLInterconTable> m_full;                //!< +Grid without Shutdown, the Cross-Plane Peers
+    double m_threshold;
+    size_t m_checked;
+
+};
+
+
+ISLGridPolarTestCase::ISLGridPolarTestCase()
+: TestCase("grid-polar-shutdown")
+, m_threshold(60.0)
+, m_checked(0)
+{
+}
+
+
+void ISLGridPolarTestCase::Check()
+{
+    Ptr<SatelliteRegistry> registry = SatelliteRegistry::Get();
+
+    auto latitude = [registry](const satid_t id) {
+        Vector pos = registry->GetSatellite(id)->GetObject<MobilityModel>()->GetPosition();
+        return std::fabs(std::asin(pos.z / std::sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z))) * 180.0 / M_PI;
+    };
+
+    for (satid_t id = 1; id <= registry->GetSatsN(); id++)
+    {
+        double lat = latitude(id);
+
+        for (const satid_t peer : m_full->GetKnownNeighbours(id))
+        {
+            if (registry->GetTag(peer)->GetOID() == registry->GetTag(id)->GetOID())
+            {
+                NS_TEST_EXPECT_MSG_EQ(m_icm->IsAvailable(id, peer), true, "Plane Link " << id << " -> " << peer << " was shut down");
+                continue;
+            }
+
+            // The Crossings are scheduled from the mean Motion, skip Pairs right at the Threshold
+            double peer_lat = latitude(peer);
+            if (std::fabs(lat - m_threshold) < 0.5 || std::fabs(peer_lat - m_threshold) < 0.5) continue;
+
+            bool expected = (lat < m_threshold && peer_lat < m_threshold);
+            NS_TEST_EXPECT_MSG_EQ(m_icm->IsAvailable(id, peer), expected, "Cross-Plane Link " << id << " -> " << peer << " at " << lat << " / " << peer_lat << " Degree");
+
+            m_checked++;
+        }
+    }
+}
+
+
+void ISLGridPolarTestCase::DoRun()
+{
+    m_constellation = CreateConstellation(WalkerConstellationHelper::WALKER_DELTA, 6, 8, 80.0);
+    m_icm = CreateObject<SatISLInterconTable>();
+    m_full = CreateObject<SatISLInterconTable>();
+
+    Ptr<SatISLGridHelper> grid = CreateObjectWithAttributes<SatISLGridHelper>("PolarLatitude", DoubleValue(m_threshold));
+    grid->Install(m_constellation, m_icm);
+
+    Ptr<SatISLGridHelper> full = CreateObject<SatISLGridHelper>();
+    full->Install(m_constellation, m_full);
+
+    for (int n = 0; n <= 10; n++)
+    {
+        Simulator::Schedule(Seconds(n * 317.0), &ISLGridPolarTestCase::Check, this);
+    }
+
+    Simulator::Stop(Seconds(3200));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_GT(m_checked, 0, "No Cross-Plane Pair was checked");
+
+    grid->Dispose();
+    full->Dispose();
+    m_icm->Dispose();
+    m_full->Dispose();
+    m_constellation = nullptr;
+    m_icm = nullptr;
+    m_full = nullptr;
+    Simulator::Destroy();
+}
+
+
+
+class ISLGridHelperTestSuite : public TestSuite
+{
+public:
+    ISLGridHelperTestSuite();
+
+};
+
+
+ISLGridHelperTestSuite::ISLGridHelperTestSuite()
+: TestSuite("isl-grid-helper-test", UNIT)
+{
+
+    AddTestCase(new ISLGridTopologyTestCase(WalkerConstellationHelper::WALKER_DELTA), TestCase::QUICK);
+    AddTestCase(new ISLGridTopologyTestCase(WalkerConstellationHelper::WALKER_STAR), TestCase::QUICK);
+    AddTestCase(new ISLGridPolarTestCase(), TestCase::QUICK);
+
+}
+
+static ISLGridHelperTestSuite g_ISLGridHelperTestSuiteInstance;
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,520 @@
+/**
+ * @brief   Tests of the ISL Routing Table, the +Grid Mode and the Source Route Tag
+ *
+ * @file    mlxsat-isl-ipv4-routing-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/internet-stack-helper.h>
+#include <ns3/ipv4.h>
+#include <ns3/ipv4-routing-helper.h>
+#include <ns3/mac48-address.h>
+#include <ns3/mobility-model.h>
+#include <ns3/node.h>
+#include <ns3/packet.h>
+#include <ns3/sat-isl-channel.h>
+#include <ns3/sat-isl-grid-helper.h>
+#include <ns3/sat-isl-intercon-table.h>
+#include <ns3/sat-isl-interface-helper.h>
+#include <ns3/sat-isl-ipv4-routing.h>
+#include <ns3/sat-isl-route-tag.h>
+#include <ns3/sat-node-registry.h>
+#include <ns3/simple-net-device.h>
+#include <ns3/walker-constellation-helper.h>
+#include <ns3/test.h>
+
+#include <cmath>
+#include <iterator>
+#include <map>
+#include <random>
+
+
+NS_LOG_COMPONENT_DEFINE("ISLIpv4RoutingTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Routing Protocol with the Lookup exposed to the Test
+ */
+class ISLRoutingLookUpProbe : public SatelliteISLRoutingIPv4
+{
+
+public:
+    using SatelliteISLRoutingIPv4::LookUp;
+
+};
+
+
+/**
+ * @brief Install the Lookup Probe as Routing Protocol
+ */
+class ISLRoutingProbeHelper : public Ipv4RoutingHelper
+{
+
+public:
+    ISLRoutingProbeHelper *Copy() const override
+    {
+        return new ISLRoutingProbeHelper(*this);
+    }
+
+    Ptr<Ipv4RoutingProtocol> Create(Ptr<Node> node) const override
+    {
+        return CreateObject<ISLRoutingLookUpProbe>();
+    }
+
+};
+
+
+/**
+ * @brief Longest-Prefix Match of the Trie against a brute-force Scan over random Prefixes
+ */
+class ISLRoutingTrieTestCase : public TestCase
+{
+
+public:
+    ISLRoutingTrieTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+ISLRoutingTrieTestCase::ISLRoutingTrieTestCase()
+: TestCase("trie-longest-match")
+{
+}
+
+
+void ISLRoutingTrieTestCase::DoRun()
+{
+    // One Interface with an Address, every Route uses it and is told apart by its Gateway
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+
+    Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+    device->SetAddress(Mac48Address::Allocate());
+    node->AddDevice(device);
+
+    Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+    uint32_t itf = ipv4->AddInterface(device);
+    ipv4->AddAddress(itf, Ipv4InterfaceAddress(Ipv4Address("192.168.0.1"), Ipv4Mask("255.255.255.0")));
+    ipv4->SetUp(itf);
+
+    Ptr<ISLRoutingLookUpProbe> routing = CreateObject<ISLRoutingLookUpProbe>();
+    routing->SetIpv4(ipv4);
+
+    auto mask = [](const uint8_t length) -> uint32_t {
+        return (length == 0) ? 0 : (0xFFFFFFFF << (32 - length));
+    };
+
+    // Reference Table: (Prefix, Length) -> Gateway
+    std::map<std::pair<uint32_t, uint8_t>, uint32_t> reference;
+    std::mt19937 rng(42);
+    uint32_t gateway = 0x0A000001;
+
+    // Few Roots make the Prefixes nest and share Branches
+    const uint32_t roots[] = {0x0A000000, 0x0A800000, 0xC0A80000, 0x64400000};
+
+    auto random_address = [&]() -> uint32_t {
+        return roots[rng() % 4] ^ (rng() & (0xFFFFFFFF >> (1 + rng() % 31)));
+    };
+
+    auto expected = [&](const uint32_t addr) -> uint32_t {
+        int best = -1;
+        uint32_t result = 0;
+        for (const auto &route : reference)
+        {
+            uint8_t length = route.first.second;
+            if ((addr & mask(length)) == route.first.first && length > best)
+            {
+                best = length;
+                result = route.second;
+            }
+        }
+        return result;
+    };
+
+    auto check = [&](const size_t queries) {
+        for (size_t q = 0; q < queries; q++)
+        {
+            uint32_t addr = random_address();
+            uint32_t gw = expected(addr);
+            Ptr<Ipv4Route> route = routing->LookUp(Ipv4Address(addr));
+
+            if (gw == 0)
+            {
+                NS_TEST_ASSERT_MSG_EQ(route, nullptr, "Route to " << Ipv4Address(addr) << " without a matching Prefix");
+            }
+            else
+            {
+                NS_TEST_ASSERT_MSG_NE(route, nullptr, "No Route to " << Ipv4Address(addr));
+                NS_TEST_ASSERT_MSG_EQ(route->GetGateway(), Ipv4Address(gw), "Wrong Match for " << Ipv4Address(addr));
+                NS_TEST_ASSERT_MSG_EQ(route->GetOutputDevice(), device, "Wrong Output Device");
+            }
+        }
+    };
+
+    check(100);
+
+    for (int round = 0; round < 20; round++)
+    {
+        // Adds, including Prefixes already present (replaced) and the Default Route
+        for (int n = 0; n < 50; n++)
+        {
+            uint8_t length = (rng() % 10 == 0) ? 0 : 8 + rng() % 25;
+            uint32_t prefix = random_address() & mask(length);
+
+            routing->AddRoutingEntry(Ipv4Address(prefix), Ipv4Mask(mask(length)), Ipv4Address(gateway), itf);
+            reference[{prefix, length}] = gateway++;
+        }
+
+        NS_TEST_ASSERT_MSG_EQ(routing->GetNRoutes(), reference.size(), "Wrong Number of Routes after the Adds");
+        check(500);
+
+        // Removes of present and of unknown Prefixes
+        for (int n = 0; n < 20; n++)
+        {
+            uint8_t length = 8 + rng() % 25;
+            uint32_t prefix = random_address() & mask(length);
+
+            if (!reference.empty() && rng() % 2 == 0)
+            {
+                auto it = reference.begin();
+                std::advance(it, rng() % reference.size());
+                prefix = it->first.first;
+                length = it->first.second;
+            }
+
+            bool present = reference.erase(std::make_pair(prefix, length)) > 0;
+            NS_TEST_ASSERT_MSG_EQ(routing->RemoveRoutingEntry(Ipv4Address(prefix), Ipv4Mask(mask(length))), present, "Remove of " << Ipv4Address(prefix) << "/" << (uint32_t) length);
+        }
+
+        NS_TEST_ASSERT_MSG_EQ(routing->GetNRoutes(), reference.size(), "Wrong Number of Routes after the Removes");
+        check(500);
+    }
+
+    routing->ClearRoutingEntries();
+    reference.clear();
+    NS_TEST_ASSERT_MSG_EQ(routing->GetNRoutes(), 0, "Clear left Routes");
+    check(50);
+
+    routing->Dispose();
+    node->Dispose();
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Next Hops of the +Grid Mode against the Links of the SatISLGridHelper
+ *
+ *        Along the Plane, to the West and East Neighbours, over the Seam (closed for a
+ *        Walker-Delta, open for a Walker-Star) and the Detour of a shut down Cross-Plane Link.
+ */
+class ISLGridRoutingTestCase : public TestCase
+{
+
+public:
+    ISLGridRoutingTestCase(const WalkerConstellationHelper::walkerConstellationType_t type);
+
+
+private:
+
+    virtual void DoRun();
+
+    WalkerConstellationHelper::walkerConstellationType_t m_type;
+
+};
+
+
+ISLGridRoutingTestCase::ISLGridRoutingTestCase(const WalkerConstellationHelper::walkerConstellationType_t type)
+: TestCase(type == WalkerConstellationHelper::WALKER_DELTA ? "grid-routing-delta" : "grid-routing-star")
+, m_type(type)
+{
+}
+
+
+void ISLGridRoutingTestCase::DoRun()
+{
+    const int planes = 4;
+    const int sats = 6;
+    const bool closed = (m_type == WalkerConstellationHelper::WALKER_DELTA);
+
+    Ptr<WalkerConstellationHelper> constellation = CreateObjectWithAttributes<WalkerConstellationHelper>(
+        "WalkerType", EnumValue(m_type),
+        "Inclination", DoubleValue(closed ? 53.0 : 86.0),
+        "NumOfOrbits", IntegerValue(planes),
+        "SatsPerOrbit", IntegerValue(sats),
+        "Phasing", DoubleValue(360.0 / (planes * sats)),
+        "MobilityModel", EnumValue(WalkerOrbitHelper::MOBILITY_CIRCULAR)
+    );
+    constellation->Initialize();
+
+    Ptr<SatISLInterconTable> icm = CreateObject<SatISLInterconTable>();
+    Ptr<SatISLGridHelper> grid = CreateObject<SatISLGridHelper>();
+    grid->Install(constellation, icm);
+
+    NodeContainer nodes;
+    for (int p = 0; p < planes; p++)
+    {
+        nodes.Add(constellation->getOrbit(p)->getSatellites());
+    }
+
+    Ptr<SatelliteISLChannel> channel = CreateObject<SatelliteISLChannel>();
+    NetDeviceContainer devices = SatelliteISLInterfaceHelper().Install(nodes, channel);
+
+    InternetStackHelper internet;
+    internet.SetRoutingHelper(ISLRoutingProbeHelper());
+    internet.Install(nodes);
+
+    // ISL Addresses are base + Satellite ID
+    const Ipv4Address base("10.0.0.0");
+    for (uint32_t n = 0; n < devices.GetN(); n++)
+    {
+        Ptr<Node> node = devices.Get(n)->GetNode();
+        Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+        satid_t id = node->GetObject<SatelliteNodeTag>()->GetId();
+
+        int32_t itf = ipv4->GetInterfaceForDevice(devices.Get(n));
+        if (itf < 0) itf = ipv4->AddInterface(devices.Get(n));
+
+        ipv4->AddAddress(itf, Ipv4InterfaceAddress(Ipv4Address(base.Get() + id), Ipv4Mask("255.255.0.0")));
+        ipv4->SetUp(itf);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(grid->ConfigureRouting(constellation, base), (size_t) (planes * sats), "Wrong Number of configured Satellites");
+
+    Ptr<SatelliteRegistry> registry = SatelliteRegistry::Get();
+
+    auto node_of = [&](const int p, const int s) {
+        return constellation->getOrbit(p)->getSatellites().Get((s + sats) % sats);
+    };
+
+    auto id_of = [&](const int p, const int s) {
+        return node_of(p, s)->GetObject<SatelliteNodeTag>()->GetId();
+    };
+
+    auto routing_of = [&](const int p, const int s) {
+        return DynamicCast<ISLRoutingLookUpProbe>(node_of(p, s)->GetObject<Ipv4>()->GetRoutingProtocol());
+    };
+
+    // Next Hop as Satellite ID, zero without a Route
+    auto next_hop = [&](const int p, const int s, const satid_t dst) -> satid_t {
+        Ptr<Ipv4Route> route = routing_of(p, s)->LookUp(Ipv4Address(base.Get() + dst));
+        return (route == nullptr) ? 0 : route->GetGateway().Get() - base.Get();
+    };
+
+    // Cross-Plane Neighbour of a Satellite in another Plane as linked by the Helper, zero if none
+    auto cross = [&](const int p, const int s, const int q) -> satid_t {
+        orbid_t oid = node_of(q, 0)->GetObject<SatelliteNodeTag>()->GetOID();
+        for (const satid_t other : icm->GetKnownNeighbours(id_of(p, s)))
+        {
+            if (registry->GetTag(other)->GetOID() == oid) return other;
+        }
+        return 0;
+    };
+
+    auto latitude = [&](const satid_t id) {
+        Vector pos = registry->GetSatellite(id)->GetObject<MobilityModel>()->GetPosition();
+        return std::fabs(std::asin(pos.z / std::sqrt(pos.x * pos.x + pos.y * pos.y + pos.z * pos.z))) * 180.0 / M_PI;
+    };
+
+    for (int p = 0; p < planes; p++)
+    {
+        for (int s = 0; s < sats; s++)
+        {
+            // Within the Plane the shorter Way around
+            NS_TEST_ASSERT_MSG_EQ(next_hop(p, s, id_of(p, s + 2)), id_of(p, s + 1), "Wrong fore Hop of " << id_of(p, s));
+            NS_TEST_ASSERT_MSG_EQ(next_hop(p, s, id_of(p, s - 2)), id_of(p, s - 1), "Wrong aft Hop of " << id_of(p, s));
+
+            // Cross-Plane Hops first, to the Slot Offset the Helper linked
+            if (p + 1 < planes)
+            {
+                NS_TEST_ASSERT_MSG_NE(cross(p, s, p + 1), 0, "No east Link of " << id_of(p, s));
+                NS_TEST_ASSERT_MSG_EQ(next_hop(p, s, id_of(p + 1, s + 3)), cross(p, s, p + 1), "Wrong east Hop of " << id_of(p, s));
+            }
+
+            if (p > 0)
+            {
+                NS_TEST_ASSERT_MSG_NE(cross(p, s, p - 1), 0, "No west Link of " << id_of(p, s));
+                NS_TEST_ASSERT_MSG_EQ(next_hop(p, s, id_of(p - 1, s)), cross(p, s, p - 1), "Wrong west Hop of " << id_of(p, s));
+            }
+        }
+    }
+
+    // Over the Seam: across it if closed, the whole Way around if open
+    for (int s = 0; s < sats; s++)
+    {
+        if (closed)
+        {
+            NS_TEST_ASSERT_MSG_NE(cross(0, s, planes - 1), 0, "No Seam Link of " << id_of(0, s));
+            NS_TEST_ASSERT_MSG_EQ(next_hop(0, s, id_of(planes - 1, s)), cross(0, s, planes - 1), "Seam not crossed westwards by " << id_of(0, s));
+            NS_TEST_ASSERT_MSG_EQ(next_hop(planes - 1, s, id_of(0, s)), cross(planes - 1, s, 0), "Seam not crossed eastwards by " << id_of(planes - 1, s));
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_EQ(cross(0, s, planes - 1), 0, "Link over the open Seam at " << id_of(0, s));
+            NS_TEST_ASSERT_MSG_EQ(next_hop(0, s, id_of(planes - 1, s)), cross(0, s, 1), "Open Seam not avoided by " << id_of(0, s));
+            NS_TEST_ASSERT_MSG_EQ(next_hop(planes - 1, s, id_of(0, s)), cross(planes - 1, s, planes - 2), "Open Seam not avoided by " << id_of(planes - 1, s));
+        }
+    }
+
+    // Polar Shutdown of the east Link of the highest Satellite of Plane 1
+    int high = 0;
+    for (int s = 1; s < sats; s++)
+    {
+        if (latitude(id_of(1, s)) > latitude(id_of(1, high))) high = s;
+    }
+
+    const satid_t self = id_of(1, high);
+    const satid_t east = cross(1, high, 2);
+    const satid_t dst = id_of(2, high);
+
+    icm->Remove(self, east);
+    icm->Remove(east, self);
+
+    // Below the PolarLatitude a missing Link is left to the (empty) Table
+    NS_TEST_ASSERT_MSG_EQ(next_hop(1, high, dst), 0, "Grid Route over a failed Link of " << self);
+
+    routing_of(1, high)->SetAttribute("PolarLatitude", DoubleValue(latitude(self) - 1.0));
+
+    satid_t detour = next_hop(1, high, dst);
+    NS_TEST_ASSERT_MSG_EQ((detour == id_of(1, high + 1) || detour == id_of(1, high - 1)), true, "No Detour along the Plane of " << self);
+    NS_TEST_ASSERT_MSG_LT(latitude(detour), latitude(self), "Detour of " << self << " not towards the Equator");
+
+    icm->Add(self, east);
+    icm->Add(east, self);
+    NS_TEST_ASSERT_MSG_EQ(next_hop(1, high, dst), east, "Cross-Plane Link of " << self << " not taken again");
+
+    grid->Dispose();
+    icm->Dispose();
+    for (uint32_t n = 0; n < nodes.GetN(); n++)
+    {
+        nodes.Get(n)->Dispose();
+    }
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Hop List of the Source Route Tag through the Packet Tag Serialization
+ */
+class ISLSourceRouteTagTestCase : public TestCase
+{
+
+public:
+    ISLSourceRouteTagTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+ISLSourceRouteTagTestCase::ISLSourceRouteTagTestCase()
+: TestCase("source-route-tag")
+{
+}
+
+
+void ISLSourceRouteTagTestCase::DoRun()
+{
+    std::vector<Ipv4Address> hops;
+    for (uint32_t n = 0; n < 5; n++)
+    {
+        hops.push_back(Ipv4Address(0x0A000001 + n));
+    }
+
+    // The first Hop receives the Packet with TTL 64, every Hop decrements it
+    const uint8_t ttl = 64;
+
+    ISLSourceRouteTag tag;
+    tag.SetHops(hops, ttl);
+    NS_TEST_ASSERT_MSG_EQ(tag.GetSerializedSize(), 2 + 4 * hops.size(), "Wrong serialized Size");
+
+    Ptr<Packet> packet = Create<Packet>(100);
+    packet->AddPacketTag(tag);
+
+    // Every Transit Hop only reads the Tag, it travels unchanged
+    ISLSourceRouteTag read;
+    NS_TEST_ASSERT_MSG_EQ(packet->PeekPacketTag(read), true, "Tag lost");
+    NS_TEST_ASSERT_MSG_EQ(read.GetNHops(), hops.size(), "Wrong Number of Hops");
+    NS_TEST_ASSERT_MSG_EQ(read.GetFirstHop(), hops[0], "Wrong first Hop");
+
+    for (size_t n = 0; n + 1 < hops.size(); n++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(read.GetNextHop(hops[n], ttl - n), hops[n + 1], "Wrong Hop after " << hops[n]);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(read.GetNextHop(hops.back(), ttl - (hops.size() - 1)), Ipv4Address(), "Hop after the last one");
+    NS_TEST_ASSERT_MSG_EQ(read.GetNextHop(Ipv4Address("192.168.0.1"), ttl - 1), Ipv4Address(), "Hop after an Address off the Path");
+    NS_TEST_ASSERT_MSG_EQ(read.GetNextHop(hops[1], ttl), Ipv4Address(), "Hop of an Address at the wrong TTL");
+    NS_TEST_ASSERT_MSG_EQ(read.GetNextHop(hops[0], ttl + 1), Ipv4Address(), "Hop before the first one");
+
+    // A Copy for the Forwarding carries the same Tag
+    ISLSourceRouteTag copied;
+    NS_TEST_ASSERT_MSG_EQ(packet->Copy()->PeekPacketTag(copied), true, "Tag lost in the Copy");
+    NS_TEST_ASSERT_MSG_EQ(copied.GetNextHop(hops[2], ttl - 2), hops[3], "Copy changed the Tag");
+
+    ISLSourceRouteTag empty;
+    NS_TEST_ASSERT_MSG_EQ(empty.GetFirstHop(), Ipv4Address(), "First Hop of an empty List");
+
+    // The longest Hop List survives the one-Byte Count
+    std::vector<Ipv4Address> longest;
+    for (uint32_t n = 0; n < ISLSourceRouteTag::MAX_HOPS; n++)
+    {
+        longest.push_back(Ipv4Address(0x0A010000 + n));
+    }
+
+    ISLSourceRouteTag full;
+    full.SetHops(longest, 255);
+
+    Ptr<Packet> other = Create<Packet>(10);
+    other->AddPacketTag(full);
+
+    ISLSourceRouteTag read_full;
+    NS_TEST_ASSERT_MSG_EQ(other->PeekPacketTag(read_full), true, "Full Tag lost");
+    NS_TEST_ASSERT_MSG_EQ(read_full.GetNHops(), ISLSourceRouteTag::MAX_HOPS, "Full Tag truncated");
+    NS_TEST_ASSERT_MSG_EQ(read_full.GetNextHop(longest[longest.size() - 2], 255 - (longest.size() - 2)), longest.back(), "Wrong last Hop of the full Tag");
+}
+
+
+
+class ISLIpv4RoutingTestSuite : public TestSuite
+{
+public:
+    ISLIpv4RoutingTestSuite();
+
+};
+
+
+ISLIpv4RoutingTestSuite::ISLIpv4RoutingTestSuite()
+: TestSuite("isl-ipv4-routing-test", UNIT)
+{
+
+    AddTestCase(new ISLRoutingTrieTestCase(), TestCase::QUICK);
+    AddTestCase(new ISLGridRoutingTestCase(WalkerConstellationHelper::WALKER_DELTA), TestCase::QUICK);
+    AddTestCase(new ISLGridRoutingTestCase(WalkerConstellationHelper::WALKER_STAR), TestCase::QUICK);
+    AddTestCase(new ISLSourceRouteTagTestCase(), TestCase::QUICK);
+
+}
+
+static ISLIpv4RoutingTestSuite g_ISLIpv4RoutingTestSuiteInstance;
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,232 @@
+/**
+ * @brief   Tests of the Link Differences of the Topology Engine
+ *
+ * @file    mlxsat-isl-topology-engine-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/node-container.h>
+#include <ns3/sat-isl-channel.h>
+#include <ns3/sat-isl-intercon-table.h>
+#include <ns3/sat-isl-interface-helper.h>
+#include <ns3/sat-isl-net-device.h>
+#include <ns3/sat-isl-topology-engine.h>
+#include <ns3/sat-node-tag.h>
+#include <ns3/test.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+
+NS_LOG_COMPONENT_DEFINE("ISLTopologyEngineTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief LinkUp / LinkDown Traces and ICM against Steps with moved Satellites
+ *
+ *        Only Links which changed since the last Step are reported, and replacing the
+ *        Channel takes all Links of the old one down.
+ */
+class ISLTopologyEngineDiffTestCase : public TestCase
+{
+
+public:
+    ISLTopologyEngineDiffTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+    void LinkUp(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b);
+
+    void LinkDown(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b);
+
+    /**
+     * @brief Check and reset the reported Links of a Step
+     *
+     * @param up        Expected LinkUp Pairs as (low, high) Node Index
+     * @param down      Expected LinkDown Pairs as (low, high) Node Index
+     */
+    void Expect(const std::set<std::pair<uint32_t, uint32_t>> &up, const std::set<std::pair<uint32_t, uint32_t>> &down, const std::string &step);
+
+    std::pair<uint32_t, uint32_t> _pair(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b) const;
+
+
+    NodeContainer m_nodes;
+    std::set<std::pair<uint32_t, uint32_t>> m_up;       //!< Reported LinkUp Pairs of the Step
+    std::set<std::pair<uint32_t, uint32_t>> m_down;     //!< Reported LinkDown Pairs of the Step
+    size_t m_reports;                                   //!< Reported Changes of the Step
+
+};
+
+
+ISLTopologyEngineDiffTestCase::ISLTopologyEngineDiffTestCase()
+: TestCase("topology-diff")
+, m_reports(0)
+{
+}
+
+
+std::pair<uint32_t, uint32_t> ISLTopologyEngineDiffTestCase::_pair(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b) const
+{
+    uint32_t na = 0, nb = 0;
+    for (uint32_t n = 0; n < m_nodes.GetN(); n++)
+    {
+        if (m_nodes.Get(n) == a->GetNode()) na = n;
+        if (m_nodes.Get(n) == b->GetNode()) nb = n;
+    }
+
+    return {std::min(na, nb), std::max(na, nb)};
+}
+
+
+void ISLTopologyEngineDiffTestCase::LinkUp(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b)
+{
+    m_up.insert(_pair(a, b));
+    m_reports++;
+}
+
+
+void ISLTopologyEngineDiffTestCase::LinkDown(Ptr<SatelliteISLNetDevice> a, Ptr<SatelliteISLNetDevice> b)
+{
+    m_down.insert(_pair(a, b));
+    m_reports++;
+}
+
+
+void ISLTopologyEngineDiffTestCase::Expect(const std::set<std::pair<uint32_t, uint32_t>> &up, const std::set<std::pair<uint32_t, uint32_t>> &down, const std::string &step)
+{
+    NS_TEST_EXPECT_MSG_EQ((m_up == up), true, "Wrong LinkUp Reports at " << step);
+    NS_TEST_EXPECT_MSG_EQ((m_down == down), true, "Wrong LinkDown Reports at " << step);
+    NS_TEST_EXPECT_MSG_EQ(m_reports, up.size() + down.size(), "Link reported twice at " << step);
+
+    m_up.clear();
+    m_down.clear();
+    m_reports = 0;
+}
+
+
+void ISLTopologyEngineDiffTestCase::DoRun()
+{
+    // Three Satellites on a Shell of 7000 km, Links up to 1500 km
+    m_nodes.Create(3);
+    std::vector<Ptr<ConstantPositionMobilityModel>> mobility;
+    std::vector<satid_t> ids;
+
+    for (uint32_t n = 0; n < m_nodes.GetN(); n++)
+    {
+        Ptr<ConstantPositionMobilityModel> mob = CreateObject<ConstantPositionMobilityModel>();
+        m_nodes.Get(n)->AggregateObject(mob);
+        mobility.push_back(mob);
+
+        Ptr<SatelliteNodeTag> tag = CreateObject<SatelliteNodeTag>();
+        m_nodes.Get(n)->AggregateObject(tag);
+        tag->Register();
+        ids.push_back(tag->GetId());
+    }
+
+    mobility[0]->SetPosition(Vector(7000e3, 0.0, 0.0));
+    mobility[1]->SetPosition(Vector(7000e3, 1000e3, 0.0));
+    mobility[2]->SetPosition(Vector(-7000e3, 0.0, 0.0));
+
+    Ptr<SatelliteISLChannel> channel = CreateObject<SatelliteISLChannel>();
+    NetDeviceContainer devices = SatelliteISLInterfaceHelper().Install(m_nodes, channel);
+
+    auto index = [&](const uint32_t n) {
+        return channel->GetDeviceIndex(Mac48Address::ConvertFrom(devices.Get(n)->GetAddress()));
+    };
+
+    Ptr<SatISLInterconTable> icm = CreateObject<SatISLInterconTable>();
+    Ptr<SatISLTopologyEngine> engine = CreateObjectWithAttributes<SatISLTopologyEngine>(
+        "MaxRange", DoubleValue(1500e3),
+        "FieldOfView", BooleanValue(false),
+        "UpdateICM", BooleanValue(true)
+    );
+    engine->SetChannel(channel);
+    engine->SetInterconTable(icm);
+
+    engine->TraceConnectWithoutContext("LinkUp", MakeCallback(&ISLTopologyEngineDiffTestCase::LinkUp, this));
+    engine->TraceConnectWithoutContext("LinkDown", MakeCallback(&ISLTopologyEngineDiffTestCase::LinkDown, this));
+
+    // First Step: 0 - 1 in Range, 2 on the far Side of the Earth
+    NS_TEST_ASSERT_MSG_EQ(engine->Update(), 1, "Wrong Number of Changes of the first Step");
+    Expect({{0, 1}}, {}, "the first Step");
+    NS_TEST_ASSERT_MSG_EQ(engine->IsLinked(index(0), index(1)), true, "0 - 1 not linked");
+    NS_TEST_ASSERT_MSG_EQ(engine->IsLinked(index(1), index(0)), true, "1 - 0 not linked");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[0], ids[1]) && icm->IsAvailable(ids[1], ids[0]), true, "0 - 1 missing in the ICM");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[0], ids[2]), false, "Occluded Link 0 - 2 in the ICM");
+
+    // Unchanged Geometry: nothing is reported again
+    NS_TEST_ASSERT_MSG_EQ(engine->Update(), 0, "Changes without Movement");
+    Expect({}, {}, "the unchanged Step");
+
+    // 2 moves next to 1, but stays out of Range of 0
+    mobility[2]->SetPosition(Vector(7000e3, 2000e3, 0.0));
+    NS_TEST_ASSERT_MSG_EQ(engine->Update(), 1, "Wrong Number of Changes after the Approach");
+    Expect({{1, 2}}, {}, "the Approach");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[1], ids[2]), true, "1 - 2 missing in the ICM");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[0], ids[2]), false, "Link 0 - 2 beyond the MaxRange");
+
+    // 0 leaves behind the Earth, 1 - 2 stays
+    mobility[0]->SetPosition(Vector(-7000e3, 0.0, 0.0));
+    NS_TEST_ASSERT_MSG_EQ(engine->Update(), 1, "Wrong Number of Changes after the Departure");
+    Expect({}, {{0, 1}}, "the Departure");
+    NS_TEST_ASSERT_MSG_EQ(engine->IsLinked(index(0), index(1)), false, "0 - 1 still linked");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[0], ids[1]) || icm->IsAvailable(ids[1], ids[0]), false, "0 - 1 left in the ICM");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[1], ids[2]), true, "1 - 2 lost in the ICM");
+
+    // A new Channel takes the remaining Links down
+    Ptr<SatelliteISLChannel> other = CreateObject<SatelliteISLChannel>();
+    engine->SetChannel(other);
+    Expect({}, {{1, 2}}, "the Channel Change");
+    NS_TEST_ASSERT_MSG_EQ(engine->GetLinks().size(), 0, "Links of the old Channel kept");
+    NS_TEST_ASSERT_MSG_EQ(icm->IsAvailable(ids[1], ids[2]) || icm->IsAvailable(ids[2], ids[1]), false, "1 - 2 left in the ICM");
+
+    engine->Dispose();
+    icm->Dispose();
+    channel->Dispose();
+    other->Dispose();
+    for (uint32_t n = 0; n < m_nodes.GetN(); n++)
+    {
+        m_nodes.Get(n)->Dispose();
+    }
+    Simulator::Destroy();
+}
+
+
+
+class ISLTopologyEngineTestSuite : public TestSuite
+{
+public:
+    ISLTopologyEngineTestSuite();
+
+};
+
+
+ISLTopologyEngineTestSuite::ISLTopologyEngineTestSuite()
+: TestSuite("isl-topology-engine-test", UNIT)
+{
+
+    AddTestCase(new ISLTopologyEngineDiffTestCase(), TestCase::QUICK);
+
+}
+
+static ISLTopologyEngineTestSuite g_ISLTopologyEngineTestSuiteInstance;
+
+
+}   /* namespace ns3 */
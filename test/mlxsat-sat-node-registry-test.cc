@@ -0,0 +1,145 @@
+/**
+ * @brief   Tests of the dense Satellite Registry
+ *
+ * @file    mlxsat-sat-node-registry-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/node.h>
+#include <ns3/sat-node-registry.h>
+#include <ns3/sat-node-tag.h>
+#include <ns3/test.h>
+
+
+NS_LOG_COMPONENT_DEFINE("SatNodeRegistryTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Register two Constellations and check IDs, Orbit and Constellation Lists and Clear
+ */
+class SatNodeRegistryTestCase : public TestCase
+{
+
+public:
+    SatNodeRegistryTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+class SatNodeRegistryTestSuite : public TestSuite
+{
+public:
+    SatNodeRegistryTestSuite();
+
+};
+
+
+SatNodeRegistryTestCase::SatNodeRegistryTestCase()
+: TestCase("registry-dense-ids")
+{
+}
+
+
+void SatNodeRegistryTestCase::DoRun()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<SatelliteRegistry> registry = CreateObject<SatelliteRegistry>();
+
+    NS_TEST_ASSERT_MSG_EQ(registry->GetSatsN(), 0, "New Registry is not empty");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetMaxOrbitId(), 0, "New Registry has Orbits");
+
+    // Constellation 1: Orbits 1 and 2 with 3 Satellites each, Constellation 2: Orbit 3 with 2
+    std::vector<Ptr<SatelliteNodeTag>> tags;
+    const cstid_t cids[] = {1, 1, 1, 1, 1, 1, 2, 2};
+    const orbid_t oids[] = {1, 1, 1, 2, 2, 2, 3, 3};
+
+    for (size_t n = 0; n < 8; n++)
+    {
+        Ptr<SatelliteNodeTag> tag = CreateObject<SatelliteNodeTag>();
+        Ptr<Node> node = CreateObject<Node>();
+        node->AggregateObject(tag);
+
+        satid_t id = registry->Register(tag, cids[n], oids[n]);
+        NS_TEST_ASSERT_MSG_EQ(id, n + 1, "Satellite IDs are not dense from 1");
+
+        tags.push_back(tag);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(registry->GetSatsN(), 8, "Wrong Number of Satellites");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetOrbitsN(), 3, "Wrong Number of Orbits");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetConstellationsN(), 2, "Wrong Number of Constellations");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetMaxOrbitId(), 3, "Wrong max. Orbit ID");
+
+    NS_TEST_ASSERT_MSG_EQ(registry->GetSatsN(2), 3, "Wrong Number of Satellites in Orbit 2");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetOrbitsN(1), 2, "Wrong Number of Orbits in Constellation 1");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetOrbitsN(7), 0, "Unknown Constellation has Orbits");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetSatsN(42), 0, "Unknown Orbit has Satellites");
+
+    const std::vector<satid_t> &orbit = registry->SatsByOrbit(2);
+    for (size_t n = 0; n < orbit.size(); n++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(orbit[n], n + 4, "Satellites of an Orbit not in Registration Order");
+    }
+
+    const std::vector<orbid_t> &orbits = registry->OrbitsByConstellation(2);
+    NS_TEST_ASSERT_MSG_EQ(orbits.size(), 1, "Wrong Orbits of Constellation 2");
+    NS_TEST_ASSERT_MSG_EQ(orbits[0], 3, "Wrong Orbit of Constellation 2");
+
+    for (size_t n = 0; n < tags.size(); n++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(registry->GetTag(n + 1), tags[n], "Lookup by ID returns the wrong Tag");
+        NS_TEST_ASSERT_MSG_EQ(registry->GetSatellite(n + 1), tags[n]->GetObject<Node>(), "Lookup by ID returns the wrong Node");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(registry->GetExists(0), false, "ID 0 must not exist");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetExists(9), false, "ID above the Range must not exist");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetTag(9), nullptr, "Unknown ID returns a Tag");
+
+    // A sparse but bounded Orbit ID is accepted
+    satid_t id = registry->Register(CreateObject<SatelliteNodeTag>(), 3, SatelliteRegistry::MAX_ORBIT_ID);
+    NS_TEST_ASSERT_MSG_EQ(id, 9, "Satellite ID after a sparse Orbit ID");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetMaxOrbitId(), SatelliteRegistry::MAX_ORBIT_ID, "Sparse Orbit ID not registered");
+
+    registry->Clear();
+    NS_TEST_ASSERT_MSG_EQ(registry->GetSatsN(), 0, "Clear left Satellites");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetOrbitsN(), 0, "Clear left Orbits");
+    NS_TEST_ASSERT_MSG_EQ(registry->GetConstellationsN(), 0, "Clear left Constellations");
+    NS_TEST_ASSERT_MSG_EQ(registry->SatsByOrbit(1).size(), 0, "Clear left Satellites in an Orbit");
+
+    registry->Dispose();
+}
+
+
+
+SatNodeRegistryTestSuite::SatNodeRegistryTestSuite()
+: TestSuite("sat-node-registry-test", UNIT)
+{
+
+    AddTestCase(
+        new SatNodeRegistryTestCase(),
+        TestCase::QUICK
+    );
+
+}
+
+static SatNodeRegistryTestSuite g_SatNodeRegistryTestSuiteInstance;
+
+
+}   /* namespace ns3 */
@@ -0,0 +1,238 @@
+/**
+ * @brief   Tests of the streaming TLE Catalog Loader
+ *
+ * @file    mlxsat-tle-catalog-test.cc
+ * @author  M. Anschuetz (martin.anschuetz@vert-tec.io)
+ * @version 1.0
+ * @date    2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+
+#include <ns3/core-module.h>
+#include <ns3/node.h>
+#include <ns3/sat-node-tag.h>
+#include <ns3/tle-catalog-helper.h>
+#include <ns3/test.h>
+
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <string>
+
+
+NS_LOG_COMPONENT_DEFINE("TleCatalogTest");
+
+
+namespace ns3
+{
+
+
+/**
+ * @brief Append the Modulo-10 Checksum to the first 68 Columns of a TLE Line
+ */
+static std::string
+TleChecksum(const std::string &body)
+{
+    int sum = 0;
+    for (const char c : body)
+    {
+        if (c >= '0' && c <= '9') sum += c - '0';
+        else if (c == '-') sum += 1;
+    }
+
+    return body + char('0' + sum % 10);
+}
+
+
+/**
+ * @brief Both Lines of a near-circular TLE at the Epoch 2024 Day 1, each terminated by eol
+ */
+static std::string
+TleEntry(const int satNo, const double inclination, const double raan, const double anomaly, const double meanMotion, const char *eol = "\n")
+{
+    char line1[80];
+    char line2[80];
+
+    std::snprintf(line1, sizeof(line1), "1 %05dU 24001A   24001.00000000  .00000000  00000-0  00000-0 0  999", satNo);
+    std::snprintf(line2, sizeof(line2), "2 %05d %8.4f %8.4f 0001000 %8.4f %8.4f %11.8f%5d", satNo, inclination, raan, 0.0, anomaly, meanMotion, 1);
+
+    return TleChecksum(line1) + eol + TleChecksum(line2) + eol;
+}
+
+
+/**
+ * @brief Plain TLE, 3LE Names with and without the "0 " Prefix, CRLF Line Ends and rejected Entries
+ */
+class TleCatalogParseTestCase : public TestCase
+{
+
+public:
+    TleCatalogParseTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+TleCatalogParseTestCase::TleCatalogParseTestCase()
+: TestCase("tle-parse")
+{
+}
+
+
+void TleCatalogParseTestCase::DoRun()
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string bad_checksum = TleEntry(1004, 53.0, 10.0, 60.0, 15.06);
+    bad_checksum[2 * 69] = (bad_checksum[2 * 69] == '0') ? '1' : '0';
+
+    // Line 2 of another Satellite after Line 1 of 1005
+    std::string mismatch = TleEntry(1005, 53.0, 10.0, 180.0, 15.06);
+    mismatch = mismatch.substr(0, 70) + TleEntry(1006, 53.0, 10.0, 180.0, 15.06).substr(70);
+
+    std::stringstream catalog;
+    catalog << TleEntry(1001, 53.0, 10.0, 0.0, 15.06, "\r\n")
+            << "SAT-A  \r\n" << TleEntry(1002, 53.0, 10.0, 120.0, 15.06, "\r\n")
+            << "\n"
+            << "0 SAT-B\n" << TleEntry(1003, 53.0, 10.0, 240.0, 15.06)
+            << "SAT-BAD\n" << bad_checksum
+            << mismatch;
+
+    Ptr<TleCatalogHelper> helper = CreateObjectWithAttributes<TleCatalogHelper>(
+        "MobilityModel", EnumValue(WalkerOrbitHelper::MOBILITY_CIRCULAR),
+        "Threads", UintegerValue(2)
+    );
+
+    NS_TEST_ASSERT_MSG_EQ(helper->Load(catalog), 3, "Wrong Number of accepted Entries");
+
+    helper->Initialize();
+
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteCount(), 3, "Wrong Number of Satellites");
+    NS_TEST_ASSERT_MSG_EQ(helper->getShellCount(), 1, "One Shell expected");
+    NS_TEST_ASSERT_MSG_EQ(helper->getPlaneCount(), 1, "One Plane expected");
+
+    // One Plane, ordered by the Argument of Latitude
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(0), "1001", "Plain TLE is not named by its Catalog Number");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(1), "SAT-A", "3LE Name with CRLF and trailing Blanks");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(2), "SAT-B", "3LE Name with the 0 Prefix");
+
+    for (size_t n = 0; n < 3; n++)
+    {
+        NS_TEST_ASSERT_MSG_NE(helper->getSatellite(n), nullptr, "Satellite has no Mobility");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatellite(3), nullptr, "Satellite beyond the Catalog");
+
+    Simulator::Destroy();
+}
+
+
+/**
+ * @brief Shells by Inclination and Altitude, Planes by the Ascending Node across 0/360 deg
+ */
+class TleCatalogClusterTestCase : public TestCase
+{
+
+public:
+    TleCatalogClusterTestCase();
+
+
+private:
+
+    virtual void DoRun();
+
+};
+
+
+TleCatalogClusterTestCase::TleCatalogClusterTestCase()
+: TestCase("tle-planes")
+{
+}
+
+
+void TleCatalogClusterTestCase::DoRun()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Shell 53 deg / 550 km: one Plane around the Node 0 deg and one at 180 deg
+    // Shell 53 deg / 800 km and Shell 97.6 deg: one Plane each
+    std::stringstream catalog;
+    catalog << TleEntry(2001, 53.0, 359.5, 0.0, 15.06)
+            << TleEntry(2002, 53.0, 0.0, 90.0, 15.06)
+            << TleEntry(2003, 53.0, 0.5, 180.0, 15.06)
+            << TleEntry(2004, 53.0, 180.0, 0.0, 15.06)
+            << TleEntry(2005, 53.0, 180.0, 180.0, 15.06)
+            << TleEntry(2006, 53.0, 90.0, 0.0, 14.30)
+            << TleEntry(2007, 97.6, 90.0, 0.0, 14.80);
+
+    Ptr<TleCatalogHelper> helper = CreateObjectWithAttributes<TleCatalogHelper>(
+        "MobilityModel", EnumValue(WalkerOrbitHelper::MOBILITY_CIRCULAR)
+    );
+
+    NS_TEST_ASSERT_MSG_EQ(helper->Load(catalog), 7, "Wrong Number of accepted Entries");
+
+    helper->Initialize();
+
+    NS_TEST_ASSERT_MSG_EQ(helper->getShellCount(), 3, "Wrong Number of Shells");
+    NS_TEST_ASSERT_MSG_EQ(helper->getPlaneCount(), 4, "Wrong Number of Planes");
+
+    std::map<std::string, Ptr<SatelliteNodeTag>> tags;
+    NodeContainer sats = helper->getSatellites();
+
+    for (size_t n = 0; n < sats.GetN(); n++)
+    {
+        tags[helper->getSatelliteName(n)] = sats.Get(n)->GetObject<SatelliteNodeTag>();
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(tags.size(), 7, "Satellite Names are not unique");
+
+    // The Plane across the Seam of the Ascending Node is not cut at 0/360 deg
+    NS_TEST_ASSERT_MSG_EQ(tags["2001"]->GetOID(), tags["2002"]->GetOID(), "Plane is cut at 360 deg");
+    NS_TEST_ASSERT_MSG_EQ(tags["2002"]->GetOID(), tags["2003"]->GetOID(), "Plane is cut at 0 deg");
+    NS_TEST_ASSERT_MSG_EQ(tags["2004"]->GetOID(), tags["2005"]->GetOID(), "Plane at 180 deg is split");
+    NS_TEST_ASSERT_MSG_NE(tags["2001"]->GetOID(), tags["2004"]->GetOID(), "Opposite Planes are merged");
+
+    NS_TEST_ASSERT_MSG_EQ(tags["2001"]->GetCID(), tags["2004"]->GetCID(), "Planes of one Shell in different Constellations");
+    NS_TEST_ASSERT_MSG_NE(tags["2001"]->GetCID(), tags["2006"]->GetCID(), "Altitude does not split the Shells");
+    NS_TEST_ASSERT_MSG_NE(tags["2006"]->GetCID(), tags["2007"]->GetCID(), "Inclination does not split the Shells");
+    NS_TEST_ASSERT_MSG_NE(tags["2001"]->GetCID(), tags["2007"]->GetCID(), "Inclination does not split the Shells");
+
+    // The Nodes start after their largest Gap, within a Plane the Satellites follow the Argument of Latitude
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(0), "2004", "Planes are not ordered from the largest Gap of the Node");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(1), "2005", "Plane is not ordered by Latitude");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(2), "2001", "Plane across the Seam is not next");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(3), "2002", "Plane is not ordered by Latitude");
+    NS_TEST_ASSERT_MSG_EQ(helper->getSatelliteName(4), "2003", "Plane is not ordered by Latitude");
+
+    Simulator::Destroy();
+}
+
+
+class TleCatalogTestSuite : public TestSuite
+{
+public:
+    TleCatalogTestSuite();
+
+};
+
+
+TleCatalogTestSuite::TleCatalogTestSuite()
+: TestSuite("tle-catalog-test", UNIT)
+{
+
+    AddTestCase(new TleCatalogParseTestCase(), TestCase::QUICK);
+    AddTestCase(new TleCatalogClusterTestCase(), TestCase::QUICK);
+
+}
+
+static TleCatalogTestSuite g_TleCatalogTestSuiteInstance;
+
+
+}   /* namespace ns3 */
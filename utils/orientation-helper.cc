@@ -14,6 +14,7 @@
 #include "orientation-helper.h"
 #include "ns3/vector-extensions.h"
 #include "ns3/angles.h"
+#include "ns3/simulator.h"
 
 
 
@@ -179,6 +180,13 @@ namespace ns3
         static TypeId tid = TypeId("ns3::LVLHReference")
             .SetParent<Object>()
             .AddConstructor<LVLHReference>()
+            .AddAttribute(
+                "Tolerance"
+                , "Max. Age of the Reference before a time-aware Update recalculates it, zero updates once per Timestamp"
+                , TimeValue(Time(0))
+                , MakeTimeAccessor(&LVLHReference::SetTolerance, &LVLHReference::GetTolerance)
+                , MakeTimeChecker(Time(0))
+            )
         ;
         return tid;
     }
@@ -194,6 +202,9 @@ namespace ns3
     : m_ex(1, 0, 0)
     , m_ey(0, 1, 0)
     , m_ez(0, 0, 1)
+    , m_stamp(Time(0))
+    , m_tolerance(Time(0))
+    , m_valid(false)
     {
     }
 
@@ -217,6 +228,8 @@ namespace ns3
     {
         NS_ASSERT_MSG(velocity.GetLength() > 0, "The Velocity Vector cannot be (0, 0, 0)!");
 
+        m_valid = false;
+
 
         if (position.GetLength() == 0)
         {
@@ -249,6 +262,40 @@ namespace ns3
     }
 
 
+    bool LVLHReference::UpdateLocalReference(const Ptr<MobilityModel> mobility)
+    {
+        Time now = Simulator::Now();
+        if (m_valid && (now - m_stamp) <= m_tolerance && now >= m_stamp)
+        {
+            return false;
+        }
+
+        UpdateLocalReference(mobility->GetPosition(), mobility->GetVelocity());
+        m_stamp = now;
+        m_valid = true;
+
+        return true;
+    }
+
+
+    void LVLHReference::Invalidate()
+    {
+        m_valid = false;
+    }
+
+
+    void LVLHReference::SetTolerance(const Time tolerance)
+    {
+        m_tolerance = tolerance;
+    }
+
+
+    Time LVLHReference::GetTolerance() const
+    {
+        return m_tolerance;
+    }
+
+
     Vector LVLHReference::ToWorldSpace(const Vector &vec) const
     {
         Vector vp = vec - m_origin;
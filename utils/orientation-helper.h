@@ -16,6 +16,8 @@
 
 #include "ns3/object.h"
 #include "ns3/vector.h"
+#include "ns3/nstime.h"
+#include "ns3/mobility-model.h"
 
 
 namespace ns3
@@ -144,6 +146,29 @@ namespace ns3
         void UpdateLocalReference(const Vector &position, const Vector &velocity);
 
 
+        /**
+         * @brief Update Local LVLH-Coordinate Reference System from a Mobility Model
+         * 
+         *        The Update is skipped if the Reference was already updated at the current
+         *        Simulation Time or within the Tolerance, so the Mobility Model is not queried.
+         * 
+         * @param mobility      Mobility Model of the Satellite
+         * @return true         if the Reference was recalculated
+         */
+        bool UpdateLocalReference(const Ptr<MobilityModel> mobility);
+
+
+        /**
+         * @brief Force a Recalculation on the next time-aware Update
+         */
+        void Invalidate();
+
+
+        void SetTolerance(const Time tolerance);
+
+        Time GetTolerance() const;
+
+
 
         Vector ToWorldSpace(const Vector &vec) const;
 
@@ -167,6 +192,12 @@ namespace ns3
         Quaternion m_t2;    // Transformation 2
 
 
+    private:
+
+        Time m_stamp;       // Simulation Time of the last Update
+        Time m_tolerance;   // Max. Age of the Reference before the next Update
+        bool m_valid;       // Reference was updated at m_stamp
+
     };  /* LVLH Reference */
 
 